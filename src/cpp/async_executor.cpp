@@ -0,0 +1,228 @@
+#include "async_executor.h"
+#include "db_wrapper.h"
+#include "helpers.h"
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+AsyncExecutor::AsyncExecutor(DBWrapper& db, size_t threads) : db(db) {
+    if (threads == 0)
+        throw std::invalid_argument("AsyncExecutor needs at least one thread");
+#ifdef __linux__
+    read_fd = write_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (read_fd < 0)
+        throw std::runtime_error("Failed to create eventfd");
+#else
+    int fds[2];
+    if (pipe(fds) != 0)
+        throw std::runtime_error("Failed to create pipe");
+    read_fd = fds[0];
+    write_fd = fds[1];
+    for (int fd : fds) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+#endif
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; i++)
+        workers.emplace_back(&AsyncExecutor::worker, this);
+}
+
+AsyncExecutor::~AsyncExecutor() {
+    close();
+    ::close(read_fd);
+    if (write_fd != read_fd)
+        ::close(write_fd);
+}
+
+uint64_t AsyncExecutor::submit(Job job) {
+    std::lock_guard lock(jobs_mutex);
+    if (stopping)
+        throw std::runtime_error("AsyncExecutor is closed");
+    uint64_t id = next_id++;
+    jobs.emplace_back(id, std::move(job));
+    jobs_cv.notify_one();
+    return id;
+}
+
+void AsyncExecutor::worker() {
+    for (;;) {
+        std::pair<uint64_t, Job> job;
+        {
+            std::unique_lock lock(jobs_mutex);
+            jobs_cv.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (stopping)
+                return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        Completion completion;
+        completion.id = job.first;
+        try {
+            job.second(completion);
+        }
+        catch (const std::exception& e) {
+            completion.error = e.what();
+        }
+        complete(std::move(completion));
+    }
+}
+
+void AsyncExecutor::complete(Completion completion) {
+    std::lock_guard lock(completions_mutex);
+    completions.push_back(std::move(completion));
+    if (completions.size() > 1)
+        return;
+#ifdef __linux__
+    uint64_t one = 1;
+    ssize_t rv = write(write_fd, &one, sizeof(one));
+#else
+    char one = 1;
+    ssize_t rv = write(write_fd, &one, sizeof(one));
+#endif
+    (void)rv;
+}
+
+py::list AsyncExecutor::drain() {
+    std::vector<Completion> done;
+    {
+        std::lock_guard lock(completions_mutex);
+        done.swap(completions);
+        char buffer[64];
+        while (read(read_fd, buffer, sizeof(buffer)) > 0) {}
+    }
+
+    py::list rv(done.size());
+    for (size_t i = 0; i < done.size(); i++) {
+        Completion& c = done[i];
+        py::object result = py::none();
+        if (c.error) {
+            rv[i] = py::make_tuple(c.id, result, py::str(*c.error));
+            continue;
+        }
+        switch (c.kind) {
+        case Completion::kNone:
+            break;
+        case Completion::kValue:
+            if (c.value)
+                result = py::bytes(*c.value);
+            break;
+        case Completion::kValues: {
+            py::list values(c.values.size());
+            for (size_t j = 0; j < c.values.size(); j++)
+                values[j] = c.values[j] ? py::object(py::bytes(*c.values[j])) : py::none();
+            result = std::move(values);
+            break;
+        }
+        case Completion::kRows:
+            result = c.rows.to_list();
+            break;
+        }
+        rv[i] = py::make_tuple(c.id, result, py::none());
+    }
+    return rv;
+}
+
+void AsyncExecutor::close() {
+    std::deque<std::pair<uint64_t, Job>> cancelled;
+    {
+        std::lock_guard lock(jobs_mutex);
+        if (stopping)
+            return;
+        stopping = true;
+        cancelled.swap(jobs);
+    }
+    jobs_cv.notify_all();
+    {
+        py::gil_scoped_release release;
+        for (auto& t : workers)
+            t.join();
+    }
+    workers.clear();
+    for (auto& job : cancelled) {
+        Completion completion;
+        completion.id = job.first;
+        completion.error = "AsyncExecutor is closed";
+        complete(std::move(completion));
+    }
+}
+
+uint64_t AsyncExecutor::submit_get(ColumnFamilyHandle cfh, const py::bytes& key, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts) {
+    rdb::ReadOptions read_options = opts ? *opts : rdb::ReadOptions();
+    snapshot = helper_snapshot(snapshot, opts);
+    return submit([this, cfh, key = std::string(key), snapshot, read_options](Completion& c) mutable {
+        c.kind = Completion::kValue;
+        std::shared_lock lock(db.db_mutex);
+        if (!cfh.check_db(db.db.get()))
+            throw std::runtime_error("Invalid column family");
+        auto snapshot_lock = db.use_snapshot(snapshot, read_options);
+        std::string value;
+        rdb::Status status = db.db->Get(read_options, cfh.get_cf_handle(), key, &value);
+        if (status.ok())
+            c.value = std::move(value);
+        else if (!status.IsNotFound())
+            throw std::runtime_error("Failed to get value: " + status.ToString());
+    });
+}
+
+uint64_t AsyncExecutor::submit_multi_get(ColumnFamilyHandle cfh, const std::vector<py::bytes>& keys, SnapshotWrapper* snapshot, 
+    const ReadOptionsWrapper* opts) {
+    rdb::ReadOptions read_options = opts ? *opts : rdb::ReadOptions();
+    snapshot = helper_snapshot(snapshot, opts);
+    std::vector<std::string> key_copies(keys.begin(), keys.end());
+    return submit([this, cfh, keys = std::move(key_copies), snapshot, read_options](Completion& c) mutable {
+        c.kind = Completion::kValues;
+        std::vector<rdb::Slice> key_slices(keys.begin(), keys.end());
+        std::vector<rdb::Status> statuses(keys.size());
+        std::shared_lock lock(db.db_mutex);
+        if (!cfh.check_db(db.db.get()))
+            throw std::runtime_error("Invalid column family");
+        auto snapshot_lock = db.use_snapshot(snapshot, read_options);
+        // Pinned blocks belong to the DB, so they are released before the lock
+        std::vector<rdb::PinnableSlice> pinned(keys.size());
+        db.db->MultiGet(read_options, cfh.get_cf_handle(), keys.size(), key_slices.data(), pinned.data(), statuses.data());
+        c.values.resize(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (statuses[i].ok())
+                c.values[i] = unpin(pinned[i]);
+            else if (!statuses[i].IsNotFound())
+                throw std::runtime_error("Failed to get value: " + statuses[i].ToString());
+        }
+    });
+}
+
+uint64_t AsyncExecutor::submit_put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, const rdb::WriteOptions* opts) {
+    rdb::WriteOptions write_options = opts ? *opts : rdb::WriteOptions();
+    return submit([this, cfh, key = std::string(key), value = std::string(value), write_options](Completion&) mutable {
+        std::shared_lock lock(db.db_mutex);
+        if (!cfh.check_db(db.db.get()))
+            throw std::runtime_error("Invalid column family");
+        rdb::Status status = db.db->Put(write_options, cfh.get_cf_handle(), key, value);
+        if (!status.ok())
+            throw std::runtime_error("Failed to put key-value: " + status.ToString());
+    });
+}
+
+uint64_t AsyncExecutor::submit_write(const WriteBatchWrapper& batch, const rdb::WriteOptions* opts) {
+    rdb::WriteOptions write_options = opts ? *opts : rdb::WriteOptions();
+    // Copied so the Python batch can be reused while the write is pending
+    auto batch_copy = std::make_shared<rdb::WriteBatch>(*batch.get_batch());
+    return submit([this, batch_copy, write_options](Completion&) {
+        std::shared_lock lock(db.db_mutex);
+        db.check_open();
+        rdb::Status status = db.db->Write(write_options, batch_copy.get());
+        if (!status.ok())
+            throw std::runtime_error("Failed to write batch: " + status.ToString());
+    });
+}
+
+uint64_t AsyncExecutor::submit_next_batch(IteratorWrapper& iter, size_t n, size_t max_bytes, bool reverse, bool reposition) {
+    return submit([&iter, n, max_bytes, reverse, reposition](Completion& c) {
+        c.kind = Completion::kRows;
+        iter.read_batch(n, max_bytes, reverse, reposition, c.rows);
+    });
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cf_handle.h"
+#include "batch_wrapper.h"
+#include "iterator_wrapper.h"
+#include "snapshot_wrapper.h"
+#include "read_options.h"
+
+namespace py  = pybind11;
+namespace rdb = rocksdb;
+
+class DBWrapper;
+
+// Runs requests against one DB on a pool of native threads, for asyncio.
+// submit_*() return a request id at once. Finished requests are queued and
+// announced through one file descriptor - an eventfd on Linux, a pipe
+// elsewhere - that becomes readable when the queue goes from empty to
+// non-empty, so a burst of completions costs the event loop a single wakeup.
+// drain() then hands all of them to Python in one call.
+//
+// Snapshots and iterators passed to submit_*() must be kept alive by the
+// caller until the request has been drained.
+class AsyncExecutor {
+public:
+    AsyncExecutor(DBWrapper& db, size_t threads);
+    ~AsyncExecutor();
+
+    int fileno() const { return read_fd; }
+
+    uint64_t submit_get(ColumnFamilyHandle cfh, const py::bytes& key, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts);
+    uint64_t submit_multi_get(ColumnFamilyHandle cfh, const std::vector<py::bytes>& keys, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts);
+    uint64_t submit_put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, const rdb::WriteOptions* opts);
+    uint64_t submit_write(const WriteBatchWrapper& batch, const rdb::WriteOptions* opts);
+    // A chunk of IteratorWrapper::read_batch; one at a time per iterator
+    uint64_t submit_next_batch(IteratorWrapper& iter, size_t n, size_t max_bytes, bool reverse, bool reposition);
+
+    // Returns (id, result, error) for every finished request and re-arms the
+    // descriptor. error is None on success, otherwise the message of the
+    // RuntimeError to raise.
+    py::list drain();
+
+    // Waits for running requests; queued ones finish with an error
+    void close();
+
+private:
+    struct Completion {
+        enum Kind { kNone, kValue, kValues, kRows };
+        uint64_t id = 0;
+        Kind kind = kNone;
+        std::optional<std::string> value;
+        std::vector<std::optional<std::string>> values;
+        KeyValueBatch rows;
+        std::optional<std::string> error;
+    };
+    typedef std::function<void(Completion&)> Job;
+
+    uint64_t submit(Job job);
+    void worker();
+    void complete(Completion completion);
+
+    DBWrapper& db;
+    std::vector<std::thread> workers;
+
+    std::mutex jobs_mutex;
+    std::condition_variable jobs_cv;
+    std::deque<std::pair<uint64_t, Job>> jobs;
+    uint64_t next_id = 1;
+    bool stopping = false;
+
+    // The descriptor is signalled iff `completions` is non-empty; both only
+    // change under completions_mutex.
+    std::mutex completions_mutex;
+    std::vector<Completion> completions;
+    int read_fd = -1, write_fd = -1;
+};
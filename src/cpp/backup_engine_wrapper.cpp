@@ -0,0 +1,198 @@
+#include "backup_engine_wrapper.h"
+#include "db_wrapper.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace py::literals;
+
+namespace {
+
+// Runs `work` on a helper thread while the calling thread, which holds no
+// locks, wakes up periodically to hand the value of `progress` to the Python
+// callback.
+rdb::Status helper_run_with_progress(const std::function<rdb::Status()>& work, const std::atomic<uint64_t>& progress, 
+    const py::object& callback) {
+    if (callback.is_none()) {
+        py::gil_scoped_release release;
+        return work();
+    }
+
+    rdb::Status status;
+    bool done = false;
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    std::thread worker([&] {
+        rdb::Status rv = work();
+        std::lock_guard lock(done_mutex);
+        status = rv;
+        done = true;
+        done_cv.notify_one();
+    });
+
+    uint64_t reported = 0;
+    try {
+        bool finished = false;
+        while (!finished) {
+            {
+                py::gil_scoped_release release;
+                std::unique_lock lock(done_mutex);
+                finished = done_cv.wait_for(lock, std::chrono::milliseconds(100), [&] { return done; });
+            }
+            uint64_t current = progress.load();
+            if (current != reported) {
+                reported = current;
+                callback(current);
+            }
+        }
+    }
+    catch (...) {
+        // The worker references this frame; the copy finishes regardless
+        py::gil_scoped_release release;
+        worker.join();
+        throw;
+    }
+    py::gil_scoped_release release;
+    worker.join();
+    return status;
+}
+
+void helper_check_backup_status(const rdb::Status& status, const std::string& what) {
+    if (!status.ok())
+        throw std::runtime_error(what + ": " + status.ToString());
+}
+
+}
+
+std::unique_ptr<BackupEngineWrapper> BackupEngineWrapper::open(const rdb::BackupEngineOptions& options) {
+    rdb::BackupEngine* engine;
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        status = rdb::BackupEngine::Open(options, rdb::Env::Default(), &engine);
+    }
+    helper_check_backup_status(status, "Failed to open backup engine");
+    return std::unique_ptr<BackupEngineWrapper>(new BackupEngineWrapper(engine, options.callback_trigger_interval_size));
+}
+
+BackupEngineWrapper::~BackupEngineWrapper() {
+    close();
+}
+
+uint32_t BackupEngineWrapper::create_new_backup(DBWrapper& db, bool flush_before_backup, const std::string& app_metadata, 
+    const py::object& progress) {
+    std::atomic<uint64_t> copied{0};
+    rdb::CreateBackupOptions options;
+    options.flush_before_backup = flush_before_backup;
+    options.progress_callback = [&copied, unit = progress_unit] { copied += unit; };
+
+    rdb::BackupID backup_id = 0;
+    rdb::Status status = helper_run_with_progress([&] {
+        std::shared_lock db_lock(db.db_mutex);
+        if (!db.db)
+            return rdb::Status::InvalidArgument("Database is closed");
+        std::lock_guard lock(mutex);
+        if (!engine)
+            return rdb::Status::InvalidArgument("Backup engine is closed");
+        return static_cast<rdb::Status>(engine->CreateNewBackupWithMetadata(options, db.db.get(), app_metadata, &backup_id));
+    }, copied, progress);
+    helper_check_backup_status(status, "Failed to create backup");
+    return backup_id;
+}
+
+py::list BackupEngineWrapper::get_backup_info() {
+    std::vector<rdb::BackupInfo> infos;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        if (!engine)
+            throw std::runtime_error("Backup engine is closed");
+        engine->GetBackupInfo(&infos);
+    }
+    py::list rv;
+    for (const auto& info : infos) {
+        rv.append(py::dict(
+            "backup_id"_a = info.backup_id,
+            "timestamp"_a = info.timestamp,
+            "size"_a = info.size,
+            "number_files"_a = info.number_files,
+            "app_metadata"_a = info.app_metadata));
+    }
+    return rv;
+}
+
+void BackupEngineWrapper::verify_backup(uint32_t backup_id, bool verify_with_checksum) {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        if (!engine)
+            throw std::runtime_error("Backup engine is closed");
+        status = engine->VerifyBackup(backup_id, verify_with_checksum);
+    }
+    helper_check_backup_status(status, "Backup verification failed");
+}
+
+void BackupEngineWrapper::restore_db_from_backup(uint32_t backup_id, const std::string& db_dir, const std::string& wal_dir, 
+    bool keep_log_files) {
+    rdb::RestoreOptions options(keep_log_files);
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        if (!engine)
+            throw std::runtime_error("Backup engine is closed");
+        if (backup_id == 0)
+            status = engine->RestoreDBFromLatestBackup(options, db_dir, wal_dir);
+        else
+            status = engine->RestoreDBFromBackup(options, backup_id, db_dir, wal_dir);
+    }
+    helper_check_backup_status(status, "Failed to restore backup");
+}
+
+void BackupEngineWrapper::purge_old_backups(uint32_t num_backups_to_keep) {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        if (!engine)
+            throw std::runtime_error("Backup engine is closed");
+        status = engine->PurgeOldBackups(num_backups_to_keep);
+    }
+    helper_check_backup_status(status, "Failed to purge backups");
+}
+
+void BackupEngineWrapper::delete_backup(uint32_t backup_id) {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        if (!engine)
+            throw std::runtime_error("Backup engine is closed");
+        status = engine->DeleteBackup(backup_id);
+    }
+    helper_check_backup_status(status, "Failed to delete backup");
+}
+
+void BackupEngineWrapper::garbage_collect() {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        if (!engine)
+            throw std::runtime_error("Backup engine is closed");
+        status = engine->GarbageCollect();
+    }
+    helper_check_backup_status(status, "Failed to garbage collect backups");
+}
+
+void BackupEngineWrapper::close() {
+    py::gil_scoped_release release;
+    std::lock_guard lock(mutex);
+    engine.reset();
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <rocksdb/utilities/backup_engine.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace py  = pybind11;
+namespace rdb = rocksdb;
+
+class DBWrapper;
+
+// Incremental backups of a live DB. Every call runs without the GIL; files
+// are copied by max_background_operations threads at up to
+// backup_rate_limit / restore_rate_limit bytes per second.
+class BackupEngineWrapper {
+public:
+    static std::unique_ptr<BackupEngineWrapper> open(const rdb::BackupEngineOptions& options);
+    ~BackupEngineWrapper();
+
+    // `progress` is called on the calling thread with the approximate number
+    // of bytes copied so far, every callback_trigger_interval_size bytes
+    uint32_t create_new_backup(DBWrapper& db, bool flush_before_backup, const std::string& app_metadata, const py::object& progress);
+    py::list get_backup_info();
+    void verify_backup(uint32_t backup_id, bool verify_with_checksum);
+    // With backup_id 0 the latest backup is restored
+    void restore_db_from_backup(uint32_t backup_id, const std::string& db_dir, const std::string& wal_dir, bool keep_log_files);
+    void purge_old_backups(uint32_t num_backups_to_keep);
+    void delete_backup(uint32_t backup_id);
+    void garbage_collect();
+    void close();
+
+private:
+    BackupEngineWrapper(rdb::BackupEngine* engine, uint64_t progress_unit) : engine(engine), progress_unit(progress_unit) {}
+
+    std::unique_ptr<rdb::BackupEngine> engine;
+    uint64_t progress_unit;
+    // BackupEngine is not thread-safe; held by every call while it runs
+    std::mutex mutex;
+};
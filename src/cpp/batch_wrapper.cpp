@@ -1,13 +1,119 @@
 #include "batch_wrapper.h"
+#include "helpers.h"
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// WriteBatch header: 8 byte sequence number and 4 byte count
+constexpr size_t kBatchHeaderSize = 12;
+
+std::vector<uint64_t> helper_read_offsets(const py::buffer& offsets, const char* name) {
+    py::buffer_info info = offsets.request();
+    if (info.ndim != 1 || info.strides[0] != info.itemsize)
+        throw std::invalid_argument(std::string(name) + " must be a contiguous 1-d array");
+
+    // Struct-style byte order prefix; a non-native order would be read wrong
+    std::string format = info.format;
+    if (!format.empty() && std::string("@=<>!").find(format[0]) != std::string::npos) {
+        const uint16_t one = 1;
+        bool native_little = *reinterpret_cast<const char*>(&one) == 1;
+        if ((format[0] == '<' && !native_little) || ((format[0] == '>' || format[0] == '!') && native_little))
+            throw std::invalid_argument(std::string(name) + " must be in native byte order");
+        format.erase(0, 1);
+    }
+    char kind = format.size() == 1 ? format[0] : 0;
+    bool is_signed = kind == 'i' || kind == 'l' || kind == 'q';
+    bool is_unsigned = kind == 'I' || kind == 'L' || kind == 'Q';
+    if ((!is_signed && !is_unsigned) || (info.itemsize != 4 && info.itemsize != 8))
+        throw std::invalid_argument(std::string(name) + " must hold 32 or 64 bit integers");
+
+    std::vector<uint64_t> rv(info.size);
+    for (py::ssize_t i = 0; i < info.size; i++) {
+        const char* p = static_cast<const char*>(info.ptr) + i * info.itemsize;
+        int64_t v;
+        if (info.itemsize == 4)
+            v = is_signed ? *reinterpret_cast<const int32_t*>(p) : *reinterpret_cast<const uint32_t*>(p);
+        else
+            v = *reinterpret_cast<const int64_t*>(p);
+        if (is_signed && v < 0)
+            throw std::invalid_argument(std::string(name) + " must not be negative");
+        rv[i] = static_cast<uint64_t>(v);
+    }
+    return rv;
+}
+
+void helper_check_offsets(const std::vector<uint64_t>& offsets, size_t buffer_size, const char* name) {
+    for (size_t i = 1; i < offsets.size(); i++) {
+        if (offsets[i] < offsets[i - 1])
+            throw std::invalid_argument(std::string(name) + " must not decrease");
+    }
+    if (!offsets.empty() && offsets.back() > buffer_size)
+        throw std::invalid_argument(std::string(name) + " point past the end of the buffer");
+}
+
+}
 
 WriteBatchWrapper::WriteBatchWrapper() : batch_(new rocksdb::WriteBatch()) {}
 
-void WriteBatchWrapper::put(ColumnFamilyHandle cfh, const std::string& key, const std::string& value) {
-    batch_->Put(cfh.get_cf_handle(), key, value);
+std::unique_ptr<WriteBatchWrapper> WriteBatchWrapper::from_data(const py::bytes& data) {
+    std::string rep = data;
+    if (rep.size() < kBatchHeaderSize)
+        throw std::invalid_argument("Not a serialized WriteBatch: too short");
+    auto rv = std::make_unique<WriteBatchWrapper>();
+    rv->batch_ = std::make_unique<rocksdb::WriteBatch>(std::move(rep));
+    return rv;
 }
 
-void WriteBatchWrapper::delete_key(ColumnFamilyHandle cfh, const std::string& key) {
-    batch_->Delete(cfh.get_cf_handle(), key);
+void WriteBatchWrapper::put(ColumnFamilyHandle cfh, const py::object& key, const py::object& value) {
+    BufferSlice key_slice(key), value_slice(value);
+    batch_->Put(cfh.get_cf_handle(), key_slice.get(), value_slice.get());
+}
+
+void WriteBatchWrapper::merge(ColumnFamilyHandle cfh, const py::object& key, const py::object& value) {
+    BufferSlice key_slice(key), value_slice(value);
+    batch_->Merge(cfh.get_cf_handle(), key_slice.get(), value_slice.get());
+}
+
+void WriteBatchWrapper::delete_key(ColumnFamilyHandle cfh, const py::object& key) {
+    BufferSlice key_slice(key);
+    batch_->Delete(cfh.get_cf_handle(), key_slice.get());
+}
+
+void WriteBatchWrapper::delete_range(ColumnFamilyHandle cfh, const py::object& begin, const py::object& end) {
+    BufferSlice begin_slice(begin), end_slice(end);
+    batch_->DeleteRange(cfh.get_cf_handle(), begin_slice.get(), end_slice.get());
+}
+
+void WriteBatchWrapper::put_many(ColumnFamilyHandle cfh, const py::sequence& keys, const py::sequence& values) {
+    size_t n = keys.size();
+    if (values.size() != n)
+        throw std::invalid_argument("put_many needs as many values as keys");
+    for (size_t i = 0; i < n; i++) {
+        py::object key = keys[i], value = values[i];
+        BufferSlice key_slice(key), value_slice(value);
+        batch_->Put(cfh.get_cf_handle(), key_slice.get(), value_slice.get());
+    }
+}
+
+void WriteBatchWrapper::put_packed(ColumnFamilyHandle cfh, const py::object& key_buffer, const py::buffer& key_offsets, 
+    const py::object& value_buffer, const py::buffer& value_offsets) {
+    BufferSlice keys(key_buffer), values(value_buffer);
+    std::vector<uint64_t> key_ends = helper_read_offsets(key_offsets, "key_offsets");
+    std::vector<uint64_t> value_ends = helper_read_offsets(value_offsets, "value_offsets");
+    if (key_ends.size() != value_ends.size())
+        throw std::invalid_argument("key_offsets and value_offsets must have the same length");
+    helper_check_offsets(key_ends, keys.get().size(), "key_offsets");
+    helper_check_offsets(value_ends, values.get().size(), "value_offsets");
+
+    const char* key_data = keys.get().data();
+    const char* value_data = values.get().data();
+    for (size_t i = 0; i + 1 < key_ends.size(); i++) {
+        batch_->Put(cfh.get_cf_handle(), 
+                    rocksdb::Slice(key_data + key_ends[i], key_ends[i + 1] - key_ends[i]),
+                    rocksdb::Slice(value_data + value_ends[i], value_ends[i + 1] - value_ends[i]));
+    }
 }
 
 void WriteBatchWrapper::clear() {
@@ -18,6 +124,15 @@ int WriteBatchWrapper::count() const {
     return batch_->Count();
 }
 
+size_t WriteBatchWrapper::data_size() const {
+    return batch_->GetDataSize();
+}
+
+py::bytes WriteBatchWrapper::data() const {
+    const std::string& rep = batch_->Data();
+    return py::bytes(rep.data(), rep.size());
+}
+
 rocksdb::WriteBatch* WriteBatchWrapper::get_batch() const {
     return batch_.get();
 }
@@ -8,18 +8,31 @@
 
 namespace py  = pybind11;
 
+// Keys and values may be bytes or any C-contiguous buffer; they are copied
+// straight into the batch.
 class WriteBatchWrapper {
 public:
     WriteBatchWrapper();
+    // Takes over a representation returned by data()
+    static std::unique_ptr<WriteBatchWrapper> from_data(const py::bytes& data);
     
-    void put(ColumnFamilyHandle cfh, const std::string& key, const std::string& value);
-    void delete_key(ColumnFamilyHandle cfh, const std::string& key);
+    void put(ColumnFamilyHandle cfh, const py::object& key, const py::object& value);
+    void merge(ColumnFamilyHandle cfh, const py::object& key, const py::object& value);
+    void delete_key(ColumnFamilyHandle cfh, const py::object& key);
+    void delete_range(ColumnFamilyHandle cfh, const py::object& begin, const py::object& end);
+    void put_many(ColumnFamilyHandle cfh, const py::sequence& keys, const py::sequence& values);
+    // Record i is key_buffer[key_offsets[i]:key_offsets[i+1]] and likewise for
+    // the value, as in Arrow binary arrays. Offsets are 1-d arrays of 32 or
+    // 64 bit integers with one more entry than there are records.
+    void put_packed(ColumnFamilyHandle cfh, const py::object& key_buffer, const py::buffer& key_offsets, 
+                    const py::object& value_buffer, const py::buffer& value_offsets);
     void clear();
     int count() const;
+    size_t data_size() const;
+    py::bytes data() const;
     
     rocksdb::WriteBatch* get_batch() const;
     
 private:
     std::unique_ptr<rocksdb::WriteBatch> batch_;
-    rdb::DB* batch_db = nullptr;
 };
@@ -1,22 +1,31 @@
 #pragma once
 #include <rocksdb/db.h>
+#include <atomic>
+#include <memory>
 
 namespace rdb = rocksdb;
 
 class ColumnFamilyHandle {
 public:
     ColumnFamilyHandle(rdb::ColumnFamilyHandle* cfh, rdb::DB* dbh) : 
-        cfh(cfh), dbh(dbh) {}
+        cfh(cfh), dbh(dbh), dropped(std::make_shared<std::atomic<bool>>(false)) {}
 
-    inline bool check_db(rdb::DB* target_dbh) {
-        return dbh == target_dbh;
+    // False for handles of another or a closed DB and of dropped column families
+    inline bool check_db(rdb::DB* target_dbh) const {
+        return dbh == target_dbh && !dropped->load();
     }
 
-    inline rdb::ColumnFamilyHandle* get_cf_handle() {
+    inline rdb::ColumnFamilyHandle* get_cf_handle() const {
         return cfh;
     }
 
+    // Invalidates every copy of this handle
+    inline void mark_dropped() {
+        dropped->store(true);
+    }
+
 private:
     rdb::ColumnFamilyHandle* cfh;
     rdb::DB* dbh;
-};
\ No newline at end of file
+    std::shared_ptr<std::atomic<bool>> dropped;
+};
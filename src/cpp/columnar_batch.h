@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Rows of a scan in the Arrow large-binary layout: keys and values each as one
+// data buffer plus n + 1 int64 offsets into it. When keys are decoded as
+// big-endian integers they go to int_keys instead, and the key buffers stay
+// empty.
+struct ColumnarBatch {
+    std::string key_data, value_data;
+    std::vector<int64_t> key_offsets{0}, value_offsets{0};
+    std::vector<int64_t> int_keys;
+    bool has_int_keys = false;
+
+    size_t size() const { return value_offsets.size() - 1; }
+};
+
+// One buffer of a ColumnarBatch, exposed to Python through the buffer
+// protocol (numpy.frombuffer, pyarrow.py_buffer, memoryview) without copying.
+// It keeps the batch alive for as long as Python references it.
+struct ColumnBuffer {
+    std::shared_ptr<const ColumnarBatch> batch;
+    const void* data;
+    size_t itemsize, count;
+
+    ColumnBuffer(std::shared_ptr<const ColumnarBatch> batch, const std::string& buffer) :
+        batch(std::move(batch)), data(buffer.data()), itemsize(1), count(buffer.size()) {}
+    ColumnBuffer(std::shared_ptr<const ColumnarBatch> batch, const std::vector<int64_t>& buffer) :
+        batch(std::move(batch)), data(buffer.empty() ? static_cast<const void*>("") : buffer.data()), itemsize(sizeof(int64_t)),
+        count(buffer.size()) {}
+};
@@ -0,0 +1,184 @@
+#include "compaction_filters.h"
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// Counts locally and publishes the totals when the compaction deletes it
+class CountingFilter : public rocksdb::CompactionFilter {
+public:
+    explicit CountingFilter(std::shared_ptr<CountingFilterFactory::Counters> counters) : counters_(std::move(counters)) {}
+    ~CountingFilter() override {
+        counters_->processed += processed_;
+        counters_->dropped += dropped_;
+    }
+
+protected:
+    bool count(bool drop) const {
+        processed_++;
+        if (drop)
+            dropped_++;
+        return drop;
+    }
+
+private:
+    std::shared_ptr<CountingFilterFactory::Counters> counters_;
+    // A filter is only used by the compaction that created it
+    mutable uint64_t processed_ = 0, dropped_ = 0;
+};
+
+class DropPrefixesFilter : public CountingFilter {
+public:
+    DropPrefixesFilter(std::shared_ptr<CountingFilterFactory::Counters> counters, const std::vector<std::string>& prefixes) :
+        CountingFilter(std::move(counters)), prefixes_(prefixes) {}
+
+    bool Filter(int /*level*/, const rocksdb::Slice& key, const rocksdb::Slice& /*existing_value*/, std::string* /*new_value*/,
+                bool* /*value_changed*/) const override {
+        return count(matches(key));
+    }
+
+    bool FilterMergeOperand(int /*level*/, const rocksdb::Slice& key, const rocksdb::Slice& /*operand*/) const override {
+        return count(matches(key));
+    }
+
+    const char* Name() const override { return "pyrocks11.DropPrefixes"; }
+
+private:
+    bool matches(const rocksdb::Slice& key) const {
+        for (const auto& prefix : prefixes_) {
+            if (key.starts_with(prefix))
+                return true;
+        }
+        return false;
+    }
+
+    std::vector<std::string> prefixes_;
+};
+
+class ExpiryFilter : public CountingFilter {
+public:
+    ExpiryFilter(std::shared_ptr<CountingFilterFactory::Counters> counters, size_t offset, size_t width, bool big_endian, uint64_t now) :
+        CountingFilter(std::move(counters)), offset_(offset), width_(width), big_endian_(big_endian), now_(now) {}
+
+    bool Filter(int /*level*/, const rocksdb::Slice& /*key*/, const rocksdb::Slice& existing_value, std::string* /*new_value*/,
+                bool* /*value_changed*/) const override {
+        if (existing_value.size() < offset_ + width_)
+            return count(false);
+        uint64_t expiry = 0;
+        for (size_t i = 0; i < width_; i++) {
+            size_t byte = big_endian_ ? i : width_ - 1 - i;
+            expiry = (expiry << 8) | static_cast<unsigned char>(existing_value[offset_ + byte]);
+        }
+        return count(expiry < now_);
+    }
+
+    const char* Name() const override { return "pyrocks11.Expiry"; }
+
+private:
+    size_t offset_, width_;
+    bool big_endian_;
+    uint64_t now_;
+};
+
+class KeepLatestVersionsFilter : public CountingFilter {
+public:
+    KeepLatestVersionsFilter(std::shared_ptr<CountingFilterFactory::Counters> counters, size_t n, size_t prefix_len,
+                             const std::string& key_prefix) :
+        CountingFilter(std::move(counters)), n_(n), prefix_len_(prefix_len), key_prefix_(key_prefix) {}
+
+    // Keys arrive in key order, so a group's versions are consecutive
+    bool Filter(int /*level*/, const rocksdb::Slice& key, const rocksdb::Slice& /*existing_value*/, std::string* /*new_value*/,
+                bool* /*value_changed*/) const override {
+        if (!key.starts_with(key_prefix_) || key.size() < prefix_len_)
+            return count(false);
+        rocksdb::Slice group(key.data(), prefix_len_);
+        if (group != rocksdb::Slice(group_)) {
+            group_.assign(group.data(), group.size());
+            versions_ = 0;
+        }
+        versions_++;
+        return count(versions_ > n_);
+    }
+
+    const char* Name() const override { return "pyrocks11.KeepLatestVersions"; }
+
+private:
+    size_t n_, prefix_len_;
+    std::string key_prefix_;
+    mutable std::string group_;
+    mutable size_t versions_ = 0;
+};
+
+class DropPrefixesFactory : public CountingFilterFactory {
+public:
+    explicit DropPrefixesFactory(std::vector<std::string> prefixes) : prefixes_(std::move(prefixes)) {}
+
+    std::unique_ptr<rocksdb::CompactionFilter> CreateCompactionFilter(const rocksdb::CompactionFilter::Context& /*context*/) override {
+        return std::make_unique<DropPrefixesFilter>(counters, prefixes_);
+    }
+
+    const char* Name() const override { return "pyrocks11.DropPrefixes"; }
+
+private:
+    std::vector<std::string> prefixes_;
+};
+
+class ExpiryFactory : public CountingFilterFactory {
+public:
+    ExpiryFactory(size_t offset, size_t width, bool big_endian, bool milliseconds, std::shared_ptr<rocksdb::Env> env) :
+        offset_(offset), width_(width), big_endian_(big_endian), milliseconds_(milliseconds), env_(std::move(env)) {}
+
+    std::unique_ptr<rocksdb::CompactionFilter> CreateCompactionFilter(const rocksdb::CompactionFilter::Context& /*context*/) override {
+        rocksdb::Env* env = env_ ? env_.get() : rocksdb::Env::Default();
+        int64_t now = 0;
+        // Without a clock nothing can be known to have expired
+        if (!env->GetCurrentTime(&now).ok() || now < 0)
+            now = 0;
+        uint64_t threshold = static_cast<uint64_t>(now) * (milliseconds_ ? 1000 : 1);
+        return std::make_unique<ExpiryFilter>(counters, offset_, width_, big_endian_, threshold);
+    }
+
+    const char* Name() const override { return "pyrocks11.Expiry"; }
+
+private:
+    size_t offset_, width_;
+    bool big_endian_, milliseconds_;
+    std::shared_ptr<rocksdb::Env> env_;
+};
+
+class KeepLatestVersionsFactory : public CountingFilterFactory {
+public:
+    KeepLatestVersionsFactory(size_t n, size_t prefix_len, std::string key_prefix) :
+        n_(n), prefix_len_(prefix_len), key_prefix_(std::move(key_prefix)) {}
+
+    std::unique_ptr<rocksdb::CompactionFilter> CreateCompactionFilter(const rocksdb::CompactionFilter::Context& /*context*/) override {
+        return std::make_unique<KeepLatestVersionsFilter>(counters, n_, prefix_len_, key_prefix_);
+    }
+
+    const char* Name() const override { return "pyrocks11.KeepLatestVersions"; }
+
+private:
+    size_t n_, prefix_len_;
+    std::string key_prefix_;
+};
+
+}
+
+std::shared_ptr<rocksdb::CompactionFilterFactory> make_drop_prefixes_filter(const std::vector<std::string>& prefixes) {
+    return std::make_shared<DropPrefixesFactory>(prefixes);
+}
+
+std::shared_ptr<rocksdb::CompactionFilterFactory> make_expiry_filter(size_t offset, size_t width, bool big_endian, bool milliseconds,
+    std::shared_ptr<rocksdb::Env> env) {
+    if (width != 4 && width != 8)
+        throw std::invalid_argument("width must be 4 or 8");
+    return std::make_shared<ExpiryFactory>(offset, width, big_endian, milliseconds, std::move(env));
+}
+
+std::shared_ptr<rocksdb::CompactionFilterFactory> make_keep_latest_versions_filter(size_t n, size_t prefix_len, const std::string& key_prefix) {
+    if (n == 0)
+        throw std::invalid_argument("n must be positive");
+    if (prefix_len < key_prefix.size())
+        throw std::invalid_argument("prefix_len must cover key_prefix");
+    return std::make_shared<KeepLatestVersionsFactory>(n, prefix_len, key_prefix);
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <rocksdb/compaction_filter.h>
+#include <rocksdb/env.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Built-in compaction filters, selected through
+// ColumnFamilyOptions::compaction_filter_factory. They run inside RocksDB's
+// compaction threads and never call back into Python.
+//
+// Each compaction gets its own filter from the factory. The filters count
+// the records they see and drop, and add their counts to the factory's when
+// the compaction finishes.
+class CountingFilterFactory : public rocksdb::CompactionFilterFactory {
+public:
+    struct Counters {
+        std::atomic<uint64_t> processed{0}, dropped{0};
+    };
+
+    uint64_t processed() const { return counters->processed.load(); }
+    uint64_t dropped() const { return counters->dropped.load(); }
+    void reset_counters() { counters->processed = 0; counters->dropped = 0; }
+
+protected:
+    std::shared_ptr<Counters> counters = std::make_shared<Counters>();
+};
+
+// Drops values and merge operands of keys that start with any of `prefixes`
+std::shared_ptr<rocksdb::CompactionFilterFactory> make_drop_prefixes_filter(const std::vector<std::string>& prefixes);
+// Drops values holding an expiry timestamp older than now: an unsigned
+// integer of `width` (4 or 8) bytes at `offset`, in seconds since the epoch
+// or milliseconds. Shorter values are kept. The current time is read from
+// `env` (the default Env if null) once per compaction.
+std::shared_ptr<rocksdb::CompactionFilterFactory> make_expiry_filter(size_t offset, size_t width, bool big_endian, bool milliseconds,
+    std::shared_ptr<rocksdb::Env> env);
+// Of the keys that start with `key_prefix`, groups those sharing their first
+// `prefix_len` bytes and keeps the first n of each group in key order. Versions
+// must therefore sort newest first, e.g. with an inverted timestamp suffix. A
+// compaction only sees part of the versions, so more than n may survive it,
+// but none of the newest n are ever dropped.
+std::shared_ptr<rocksdb::CompactionFilterFactory> make_keep_latest_versions_filter(size_t n, size_t prefix_len, const std::string& key_prefix);
@@ -1,6 +1,8 @@
 #pragma once
 #include <inttypes.h>
+#include <stddef.h>
 #include <string>
+#include <unordered_map>
 #include <stdio.h>
 
 enum class DbOpenType : int {
@@ -25,26 +27,40 @@ struct DbOpenRO : DbOpenBase {
     DbOpenRO() { type = DbOpenType::RO; }
 };
 
-//TODO : UNFINISHED
+// Values expire `ttl` seconds after they were written and are dropped by
+// compaction. `ttls` overrides the TTL per column family; 0 or less never expires.
 struct DbOpenTTL : DbOpenBase {
-    DbOpenTTL(uint64_t ttl, bool read_only) : type(DbOpenType::TTL), ttl(ttl), read_only(read_only) {}
-    DbOpenType type;
-    int ttl;
+    DbOpenTTL(int32_t ttl, bool read_only, const std::unordered_map<std::string, int32_t>& ttls) : 
+        ttl(ttl), read_only(read_only), ttls(ttls) { type = DbOpenType::TTL; }
+    int32_t ttl;
     bool read_only;
+    std::unordered_map<std::string, int32_t> ttls;
 };
 
+// Read-only follower of a primary running in another process. It keeps its
+// own info log and state in `secondary_path` and sees new writes after
+// catching up, every `catch_up_interval_ms` if non-zero.
 struct DbOpenSecondary : DbOpenBase {
-    DbOpenType type;
-    std::string name;
-    DbOpenSecondary(const std::string& name) : type(DbOpenType::SECONDARY), name(name) {}
+    DbOpenSecondary(const std::string& secondary_path, uint32_t catch_up_interval_ms) : 
+        secondary_path(secondary_path), catch_up_interval_ms(catch_up_interval_ms) { type = DbOpenType::SECONDARY; }
+    std::string secondary_path;
+    uint32_t catch_up_interval_ms;
 };
 
-struct DBOpenOptimisticTransation : DbOpenBase {
-    DbOpenType type = DbOpenType::OPTIMISTIC_TRANSACTION;
+// Transactions validated at commit: a write conflict makes the commit fail
+// instead of blocking other writers.
+struct DbOpenOptimisticTransaction : DbOpenBase {
+    DbOpenOptimisticTransaction() { type = DbOpenType::OPTIMISTIC_TRANSACTION; }
 };
 
-struct DBOpenTransation : DbOpenBase {
-    DbOpenType type = DbOpenType::TRANSACTION;
-
-    //TODO : add arguments
-};
\ No newline at end of file
+// Transactions that lock the keys they write or read for update. Timeouts are
+// in milliseconds, negative means wait forever; see rocksdb::TransactionDBOptions.
+struct DbOpenTransaction : DbOpenBase {
+    DbOpenTransaction(int64_t transaction_lock_timeout, int64_t default_lock_timeout, size_t num_stripes, int64_t max_num_locks) :
+        transaction_lock_timeout(transaction_lock_timeout), default_lock_timeout(default_lock_timeout),
+        num_stripes(num_stripes), max_num_locks(max_num_locks) { type = DbOpenType::TRANSACTION; }
+    int64_t transaction_lock_timeout;
+    int64_t default_lock_timeout;
+    size_t num_stripes;
+    int64_t max_num_locks;
+};
@@ -1,17 +1,49 @@
 #include "db_wrapper.h"
 #include "helpers.h"
+#include "env_registry.h"
+#include "parallel_scan.h"
+#include "group_commit_writer.h"
 #include <rocksdb/db.h>
 #include <rocksdb/options.h>
 #include <rocksdb/utilities/db_ttl.h>
+#include <rocksdb/utilities/optimistic_transaction_db.h>
+#include <rocksdb/utilities/transaction_db.h>
+#include <rocksdb/utilities/checkpoint.h>
+#include <rocksdb/convenience.h>
 
+#include <chrono>
 #include <stdexcept>
 #include <optional>
+#include <mutex>
+#include <shared_mutex>
 
 #include <iostream>
 
 
+// Pinned values hold their own reference to the DB, so it is closed by
+// whoever drops the last one - normally DBWrapper::close(), but possibly the
+// garbage collector. Closing joins background work, so not under the GIL.
+void helper_close_db(rdb::DB* db) {
+    std::optional<py::gil_scoped_release> release;
+    if (PyGILState_Check())
+        release.emplace();
+    db->Close();
+    delete db;
+}
+
+// Copied while the GIL is held: the Python object may be changed by another
+// thread once it is released.
+rdb::ReadOptions helper_read_options(const ReadOptionsWrapper* opts) {
+    return opts ? *opts : rdb::ReadOptions();
+}
+
+rdb::WriteOptions helper_write_options(const rdb::WriteOptions* opts) {
+    return opts ? *opts : rdb::WriteOptions();
+}
+
 DBWrapper::DBWrapper(rdb::DB* db, const std::vector<rdb::ColumnFamilyDescriptor>& cf_desc, 
-    const std::vector<rdb::ColumnFamilyHandle*>& handles) : db(db) 
+    const std::vector<rdb::ColumnFamilyHandle*>& handles, std::shared_ptr<rdb::Env> env) : 
+    db(db, [env](rdb::DB* p) { helper_close_db(p); }) 
 {
     default_cfh = nullptr;
     for(size_t i=0; i < handles.size(); i++) {
@@ -25,7 +57,7 @@ DBWrapper::DBWrapper(rdb::DB* db, const std::vector<rdb::ColumnFamilyDescriptor>
 }
 
 DBWrapper::~DBWrapper() {
-    close();
+    close_db(false);
 }
 
 std::vector<rdb::ColumnFamilyDescriptor> helper_parse_colum_families_opt(const py::object& column_families) {
@@ -69,13 +101,55 @@ std::unique_ptr<DBWrapper> DBWrapper::open(const std::string& path, const rdb::D
     rdb::DB* db;
 
     rocksdb::Status status;
-    switch(access_type.type) {
-    case DbOpenType::RW:
-        status = rdb::DB::Open(db_options, path, cf_desc, &handles, &db);
-        break;
-    case DbOpenType::RO:
-        status = rdb::DB::OpenForReadOnly(db_options, path, cf_desc, &handles, &db);
-        break;
+    {
+        // Opening replays the WAL and recovers the MANIFEST, which can take long
+        py::gil_scoped_release release;
+        switch(access_type.type) {
+        case DbOpenType::RW:
+            status = rdb::DB::Open(db_options, path, cf_desc, &handles, &db);
+            break;
+        case DbOpenType::RO:
+            status = rdb::DB::OpenForReadOnly(db_options, path, cf_desc, &handles, &db);
+            break;
+        case DbOpenType::TTL: {
+            const auto& ttl_open = static_cast<const DbOpenTTL&>(access_type);
+            std::vector<int32_t> ttls;
+            ttls.reserve(cf_desc.size());
+            for (const auto& desc : cf_desc) {
+                auto it = ttl_open.ttls.find(desc.name);
+                ttls.push_back(it != ttl_open.ttls.end() ? it->second : ttl_open.ttl);
+            }
+            rdb::DBWithTTL* ttl_db;
+            status = rdb::DBWithTTL::Open(db_options, path, cf_desc, &handles, &ttl_db, ttls, ttl_open.read_only);
+            db = ttl_db;
+            break;
+        }
+        case DbOpenType::SECONDARY: {
+            const auto& secondary_open = static_cast<const DbOpenSecondary&>(access_type);
+            status = rdb::DB::OpenAsSecondary(db_options, path, secondary_open.secondary_path, cf_desc, &handles, &db);
+            break;
+        }
+        case DbOpenType::OPTIMISTIC_TRANSACTION: {
+            rdb::OptimisticTransactionDB* txn_db;
+            status = rdb::OptimisticTransactionDB::Open(db_options, path, cf_desc, &handles, &txn_db);
+            db = txn_db;
+            break;
+        }
+        case DbOpenType::TRANSACTION: {
+            const auto& txn_open = static_cast<const DbOpenTransaction&>(access_type);
+            rdb::TransactionDBOptions txn_db_options;
+            txn_db_options.transaction_lock_timeout = txn_open.transaction_lock_timeout;
+            txn_db_options.default_lock_timeout = txn_open.default_lock_timeout;
+            txn_db_options.num_stripes = txn_open.num_stripes;
+            txn_db_options.max_num_locks = txn_open.max_num_locks;
+            rdb::TransactionDB* txn_db;
+            status = rdb::TransactionDB::Open(db_options, txn_db_options, path, cf_desc, &handles, &txn_db);
+            db = txn_db;
+            break;
+        }
+        default:
+            throw std::invalid_argument("Unsupported open type");
+        }
     }
     
     if (!status.ok()) {
@@ -87,11 +161,20 @@ std::unique_ptr<DBWrapper> DBWrapper::open(const std::string& path, const rdb::D
         throw std::runtime_error("Got a different number of handles from db than descriptors.");
     }
 
-    return std::unique_ptr<DBWrapper>(new DBWrapper(db, cf_desc, handles));
+    std::shared_ptr<rdb::Env> env = EnvRegistry::get(db_options.env);
+
+    auto rv = std::unique_ptr<DBWrapper>(new DBWrapper(db, cf_desc, handles, std::move(env)));
+    if (access_type.type == DbOpenType::SECONDARY) {
+        uint32_t interval_ms = static_cast<const DbOpenSecondary&>(access_type).catch_up_interval_ms;
+        if (interval_ms > 0)
+            rv->start_catch_up(interval_ms);
+    }
+    return rv;
 }
 
 
 ColumnFamilyHandle DBWrapper::get_column_family(const char* name) {
+    std::shared_lock lock(cf_mutex);
     auto s = cfh.find(name); 
     if(s == cfh.end())
         throw std::runtime_error("Column Family not found");
@@ -99,24 +182,37 @@ ColumnFamilyHandle DBWrapper::get_column_family(const char* name) {
     return s->second;
 }
 
-void DBWrapper::put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value) {
-    if(!cfh.check_db(db.get())){
-        throw std::runtime_error("Invalid column family");
+void DBWrapper::put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, const rdb::WriteOptions* opts) {
+    rdb::Slice key_slice = toslice(key), value_slice = toslice(value);
+    rdb::WriteOptions write_options = helper_write_options(opts);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = db->Put(write_options, cfh.get_cf_handle(), key_slice, value_slice);
     }
-
-    rocksdb::Status status = db->Put(rocksdb::WriteOptions(), cfh.get_cf_handle(), toslice(key), toslice(value));
     if (!status.ok()) {
         throw std::runtime_error("Failed to put key-value: " + status.ToString());
     }
 }
 
-std::optional<py::bytes> DBWrapper::get(ColumnFamilyHandle cfh, const py::bytes& key) {
-    if(!cfh.check_db(db.get())){
-        throw std::runtime_error("Invalid column family");
-    }
-
+std::optional<py::bytes> DBWrapper::get(ColumnFamilyHandle cfh, const py::bytes& key, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts) {
+    rdb::Slice key_slice = toslice(key);
+    rdb::ReadOptions read_options = helper_read_options(opts);
     std::string value;
-    rocksdb::Status status = db->Get(rocksdb::ReadOptions(), cfh.get_cf_handle(),  toslice(key), &value);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        auto snapshot_lock = use_snapshot(helper_snapshot(snapshot, opts), read_options);
+        status = db->Get(read_options, cfh.get_cf_handle(), key_slice, &value);
+    }
     
     std::optional<py::bytes> rv;
     if(status.ok()) {
@@ -131,25 +227,219 @@ std::optional<py::bytes> DBWrapper::get(ColumnFamilyHandle cfh, const py::bytes&
     return rv;
 }
 
-void DBWrapper::delete_key(ColumnFamilyHandle cfh, const py::bytes& key) {
-    if(!cfh.check_db(db.get())){
-        throw std::runtime_error("Invalid column family");
+std::vector<rdb::Slice> helper_to_slices(const std::vector<py::bytes>& keys) {
+    std::vector<rdb::Slice> slices;
+    slices.reserve(keys.size());
+    for (const auto& key : keys)
+        slices.push_back(toslice(key));
+    return slices;
+}
+
+py::list helper_multi_get_result(std::vector<std::string>& values, const std::vector<rdb::Status>& statuses) {
+    py::list rv(values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        if (statuses[i].ok())
+            rv[i] = py::bytes(values[i]);
+        else if (statuses[i].IsNotFound())
+            rv[i] = py::none();
+        else
+            throw std::runtime_error("Failed to get value: " + statuses[i].ToString());
     }
+    return rv;
+}
 
-    rocksdb::Status status = db->Delete(rocksdb::WriteOptions(), cfh.get_cf_handle(), toslice(key));
+py::list DBWrapper::multi_get(ColumnFamilyHandle cfh, const std::vector<py::bytes>& keys, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts) {
+    std::vector<rdb::Slice> key_slices = helper_to_slices(keys);
+    rdb::ReadOptions read_options = helper_read_options(opts);
+    std::vector<std::string> values(keys.size());
+    std::vector<rdb::Status> statuses(keys.size());
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+
+        auto snapshot_lock = use_snapshot(helper_snapshot(snapshot, opts), read_options);
+        std::vector<rdb::PinnableSlice> pinned(keys.size());
+        db->MultiGet(read_options, cfh.get_cf_handle(), keys.size(), key_slices.data(), pinned.data(), statuses.data());
+        // Pinned blocks belong to the DB, so release them before dropping the lock
+        for (size_t i = 0; i < pinned.size(); i++)
+            values[i] = unpin(pinned[i]);
+    }
+    return helper_multi_get_result(values, statuses);
+}
+
+py::list DBWrapper::multi_get_cf(const std::vector<ColumnFamilyHandle>& cfhs, const std::vector<py::bytes>& keys, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts) {
+    if (cfhs.size() != keys.size()) {
+        throw std::invalid_argument("multi_get_cf needs one column family handle per key");
+    }
+
+    std::vector<rdb::Slice> key_slices = helper_to_slices(keys);
+    rdb::ReadOptions read_options = helper_read_options(opts);
+    std::vector<std::string> values(keys.size());
+    std::vector<rdb::Status> statuses(keys.size());
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        std::vector<rdb::ColumnFamilyHandle*> handles;
+        handles.reserve(cfhs.size());
+        for (auto cfh : cfhs) {
+            if(!cfh.check_db(db.get())){
+                throw std::runtime_error("Invalid column family");
+            }
+            handles.push_back(cfh.get_cf_handle());
+        }
+
+        auto snapshot_lock = use_snapshot(helper_snapshot(snapshot, opts), read_options);
+        std::vector<rdb::PinnableSlice> pinned(keys.size());
+        db->MultiGet(read_options, keys.size(), handles.data(), key_slices.data(), pinned.data(), statuses.data());
+        for (size_t i = 0; i < pinned.size(); i++)
+            values[i] = unpin(pinned[i]);
+    }
+    return helper_multi_get_result(values, statuses);
+}
+
+std::unique_ptr<PinnedValue> DBWrapper::get_pinned(ColumnFamilyHandle cfh, const py::bytes& key, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts) {
+    rdb::Slice key_slice = toslice(key);
+    rdb::ReadOptions read_options = helper_read_options(opts);
+    std::unique_ptr<PinnedValue> value;
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        auto snapshot_lock = use_snapshot(helper_snapshot(snapshot, opts), read_options);
+        value = std::make_unique<PinnedValue>(db, pins);
+        status = db->Get(read_options, cfh.get_cf_handle(), key_slice, value->slice());
+        value->release_if_copied();
+    }
+
+    if(status.IsNotFound()) {
+        return nullptr;
+    }
+    if(!status.ok()) {
+        throw std::runtime_error("Failed to get value: " + status.ToString());
+    }
+    return value;
+}
+
+void DBWrapper::merge(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, const rdb::WriteOptions* opts) {
+    rdb::Slice key_slice = toslice(key), value_slice = toslice(value);
+    rdb::WriteOptions write_options = helper_write_options(opts);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = db->Merge(write_options, cfh.get_cf_handle(), key_slice, value_slice);
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to merge value: " + status.ToString());
+    }
+}
+
+void DBWrapper::delete_key(ColumnFamilyHandle cfh, const py::bytes& key, const rdb::WriteOptions* opts) {
+    rdb::Slice key_slice = toslice(key);
+    rdb::WriteOptions write_options = helper_write_options(opts);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = db->Delete(write_options, cfh.get_cf_handle(), key_slice);
+    }
     if (!status.ok()) {
         throw std::runtime_error("Failed to delete key: " + status.ToString());
     }
 }
 
-void DBWrapper::write(const WriteBatchWrapper& batch) {
-    rocksdb::Status status = db->Write(rocksdb::WriteOptions(), batch.get_batch());
+void DBWrapper::delete_range(ColumnFamilyHandle cfh, const py::bytes& begin, const py::bytes& end, const rdb::WriteOptions* opts) {
+    rdb::Slice begin_slice = toslice(begin), end_slice = toslice(end);
+    rdb::WriteOptions write_options = helper_write_options(opts);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = db->DeleteRange(write_options, cfh.get_cf_handle(), begin_slice, end_slice);
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to delete range: " + status.ToString());
+    }
+}
+
+void DBWrapper::delete_files_in_range(ColumnFamilyHandle cfh, const std::optional<py::bytes>& begin, const std::optional<py::bytes>& end, bool include_end) {
+    std::optional<rdb::Slice> slice_begin, slice_end;
+    if (begin)
+        slice_begin.emplace(toslice(begin.value()));
+
+    if (end)
+        slice_end.emplace(toslice(end.value()));
+
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = rdb::DeleteFilesInRange(db.get(), cfh.get_cf_handle(),
+                                         slice_begin ? &slice_begin.value() : nullptr,
+                                         slice_end ? &slice_end.value() : nullptr,
+                                         include_end);
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to delete files in range: " + status.ToString());
+    }
+}
+
+void DBWrapper::write(const WriteBatchWrapper& batch, const rdb::WriteOptions* opts) {
+    rdb::WriteOptions write_options = helper_write_options(opts);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        status = db->Write(write_options, batch.get_batch());
+    }
     if (!status.ok()) {
         throw std::runtime_error("Failed to write batch: " + status.ToString());
     }
 }
 
-void DBWrapper::compact_range(const rdb::CompactRangeOptions& opt, const std::optional<py::bytes>& from_key, const std::optional<py::bytes>& to_key) {
+void DBWrapper::ingest_external_file(const std::vector<std::string>& paths, ColumnFamilyHandle cfh, bool move_files, 
+    bool snapshot_consistency, bool allow_global_seqno, bool ingest_behind) {
+    rdb::IngestExternalFileOptions opts;
+    opts.move_files = move_files;
+    opts.snapshot_consistency = snapshot_consistency;
+    opts.allow_global_seqno = allow_global_seqno;
+    opts.ingest_behind = ingest_behind;
+
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = db->IngestExternalFile(cfh.get_cf_handle(), paths, opts);
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to ingest external files: " + status.ToString());
+    }
+}
+
+void DBWrapper::compact_range(const rdb::CompactRangeOptions& opt, const std::optional<py::bytes>& from_key, const std::optional<py::bytes>& to_key,
+    std::optional<ColumnFamilyHandle> cfh) {
     std::optional<rdb::Slice> slice_from, slice_to;
     if (from_key)
         slice_from.emplace(toslice(from_key.value()));
@@ -157,42 +447,593 @@ void DBWrapper::compact_range(const rdb::CompactRangeOptions& opt, const std::op
     if (to_key)
         slice_to.emplace(toslice(to_key.value()));
     
-    rocksdb::Status status = db->CompactRange(opt, 
-                                             slice_from ? &slice_from.value() : nullptr,
-                                             slice_to ? &slice_to.value() : nullptr);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        status = db->CompactRange(opt, property_cf(cfh),
+                                  slice_from ? &slice_from.value() : nullptr,
+                                  slice_to ? &slice_to.value() : nullptr);
+    }
     if (!status.ok()) {
         throw std::runtime_error("CompactRange failed " + status.ToString());
     }
 }
 
-std::unique_ptr<IteratorWrapper> DBWrapper::create_iterator(ColumnFamilyHandle cfh) {
+std::vector<rdb::ColumnFamilyHandle*> DBWrapper::resolve_cfs(const std::optional<std::vector<ColumnFamilyHandle>>& cfhs) const {
+    check_open();
+    std::vector<rdb::ColumnFamilyHandle*> rv;
+    if (!cfhs) {
+        std::shared_lock cf_lock(cf_mutex);
+        for (const auto& [name, handle] : cfh)
+            rv.push_back(handle.get_cf_handle());
+        return rv;
+    }
+    for (ColumnFamilyHandle handle : *cfhs) {
+        if (!handle.check_db(db.get())) {
+            throw std::runtime_error("Invalid column family");
+        }
+        rv.push_back(handle.get_cf_handle());
+    }
+    return rv;
+}
+
+void DBWrapper::flush(const std::optional<std::vector<ColumnFamilyHandle>>& cfhs, bool wait, bool allow_write_stall) {
+    rdb::FlushOptions flush_options;
+    flush_options.wait = wait;
+    flush_options.allow_write_stall = allow_write_stall;
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        status = db->Flush(flush_options, resolve_cfs(cfhs));
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to flush: " + status.ToString());
+    }
+}
+
+void DBWrapper::flush_wal(bool sync) {
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        status = db->FlushWAL(sync);
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to flush WAL: " + status.ToString());
+    }
+}
+
+bool DBWrapper::wait_for_compact(bool flush, bool abort_on_pause, uint64_t timeout_ms) {
+    rdb::WaitForCompactOptions wait_options;
+    wait_options.flush = flush;
+    wait_options.abort_on_pause = abort_on_pause;
+    wait_options.timeout = std::chrono::microseconds(timeout_ms * 1000);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        status = db->WaitForCompact(wait_options);
+    }
+    if (status.IsTimedOut())
+        return false;
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to wait for compaction: " + status.ToString());
+    }
+    return true;
+}
+
+void DBWrapper::pause_background_work() {
+    rocksdb::Status status;
+    {
+        // Waits for running flushes and compactions to finish
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        status = db->PauseBackgroundWork();
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to pause background work: " + status.ToString());
+    }
+}
+
+void DBWrapper::continue_background_work() {
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        status = db->ContinueBackgroundWork();
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to continue background work: " + status.ToString());
+    }
+}
+
+void DBWrapper::enable_auto_compaction(const std::optional<std::vector<ColumnFamilyHandle>>& cfhs) {
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        status = db->EnableAutoCompaction(resolve_cfs(cfhs));
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to enable auto compaction: " + status.ToString());
+    }
+}
+
+std::unique_ptr<IteratorWrapper> DBWrapper::create_iterator(ColumnFamilyHandle cfh, const IteratorOptions& opts, SnapshotWrapper* snapshot, 
+    const ReadOptionsWrapper* read_opts) {
+    std::shared_lock lock(db_mutex);
+    if(!cfh.check_db(db.get())){
+        throw std::runtime_error("Invalid column family");
+    }
+
+    // The iterator pins the snapshot's sequence number when it is created,
+    // so it stays consistent even if the snapshot is released afterwards.
+    rdb::ReadOptions read_options = helper_read_options(read_opts);
+    auto snapshot_lock = use_snapshot(helper_snapshot(snapshot, read_opts), read_options);
+    auto iter = std::make_unique<IteratorWrapper>(this, db, cfh.get_cf_handle(), opts, read_options, pins);
+
+    std::lock_guard registry_lock(iterators_mutex);
+    iterators.insert(iter.get());
+    return iter;
+}
+
+void DBWrapper::release_iterator(IteratorWrapper& iter) {
+    std::lock_guard registry_lock(iterators_mutex);
+    std::lock_guard lock(iter.mutex_);
+    iter.iter_.reset();
+    iter.db_.reset();
+    iterators.erase(&iter);
+}
+
+void DBWrapper::release_writer(GroupCommitWriter& writer) {
+    std::lock_guard registry_lock(writers_mutex);
+    writer.stop();
+    writers.erase(&writer);
+}
+
+void DBWrapper::release_scan(ParallelScan& scan) {
+    std::lock_guard registry_lock(iterators_mutex);
+    scan.stop();
+    scans.erase(&scan);
+}
+
+std::shared_lock<std::shared_mutex> DBWrapper::use_snapshot(SnapshotWrapper* snapshot, rdb::ReadOptions& read_options) const {
+    if (snapshot == nullptr)
+        return {};
+
+    std::shared_lock lock(snapshot->mutex);
+    if (snapshot->snapshot == nullptr)
+        throw std::runtime_error("Snapshot has been released");
+    if (snapshot->owner != this)
+        throw std::runtime_error("Snapshot belongs to a different database");
+
+    read_options.snapshot = snapshot->snapshot;
+    return lock;
+}
+
+void DBWrapper::try_catch_up_with_primary() {
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        status = db->TryCatchUpWithPrimary();
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to catch up with primary: " + status.ToString());
+    }
+}
+
+void DBWrapper::start_catch_up(uint32_t interval_ms) {
+    if (interval_ms == 0)
+        throw std::invalid_argument("interval_ms must be positive");
+    stop_catch_up();
+    {
+        std::shared_lock lock(db_mutex);
+        check_open();
+    }
+
+    std::lock_guard stop_lock(catch_up_mutex);
+    catch_up_stop = false;
+    catch_up_thread = std::thread([this, interval_ms]() {
+        std::unique_lock stop_lock(catch_up_mutex);
+        while (!catch_up_cv.wait_for(stop_lock, std::chrono::milliseconds(interval_ms), [this] { return catch_up_stop; })) {
+            stop_lock.unlock();
+            {
+                // Failures are transient (e.g. the primary is mid-flush) and
+                // surface on the next explicit try_catch_up_with_primary()
+                std::shared_lock lock(db_mutex);
+                if (db)
+                    db->TryCatchUpWithPrimary().PermitUncheckedError();
+            }
+            stop_lock.lock();
+        }
+    });
+}
+
+void DBWrapper::stop_catch_up() {
+    std::thread thread;
+    {
+        std::lock_guard stop_lock(catch_up_mutex);
+        if (!catch_up_thread.joinable())
+            return;
+        catch_up_stop = true;
+        thread = std::move(catch_up_thread);
+    }
+    catch_up_cv.notify_all();
+    py::gil_scoped_release release;
+    thread.join();
+}
+
+void DBWrapper::set_ttl(ColumnFamilyHandle cfh, int32_t ttl) {
+    std::shared_lock lock(db_mutex);
     if(!cfh.check_db(db.get())){
         throw std::runtime_error("Invalid column family");
     }
+    auto ttl_db = dynamic_cast<rdb::DBWithTTL*>(db.get());
+    if (ttl_db == nullptr)
+        throw std::runtime_error("Database was not opened with TTL");
 
-    return std::make_unique<IteratorWrapper>(db->NewIterator(rocksdb::ReadOptions(), cfh.get_cf_handle()));
+    auto status = ttl_db->SetTtl(cfh.get_cf_handle(), ttl);
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to set TTL: " + status.ToString());
+    }
 }
 
-const rocksdb::Snapshot* DBWrapper::create_snapshot() {
-    return db->GetSnapshot();
+void DBWrapper::create_checkpoint(const std::string& checkpoint_dir, uint64_t log_size_for_flush) {
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        rdb::Checkpoint* checkpoint;
+        status = rdb::Checkpoint::Create(db.get(), &checkpoint);
+        if (status.ok()) {
+            std::unique_ptr<rdb::Checkpoint> owner(checkpoint);
+            status = checkpoint->CreateCheckpoint(checkpoint_dir, log_size_for_flush);
+        }
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to create checkpoint: " + status.ToString());
+    }
 }
 
-void DBWrapper::release_snapshot(const rocksdb::Snapshot* snapshot) {
-    db->ReleaseSnapshot(snapshot);
+std::unique_ptr<SnapshotWrapper> DBWrapper::create_snapshot() {
+    std::shared_lock lock(db_mutex);
+    check_open();
+    auto snapshot = std::make_unique<SnapshotWrapper>(this, db->GetSnapshot());
+
+    std::lock_guard registry_lock(snapshots_mutex);
+    snapshots.insert(snapshot.get());
+    return snapshot;
+}
+
+void DBWrapper::release_snapshot(SnapshotWrapper& snapshot) {
+    // Only the owner has it in its registry and may release it
+    if (snapshot.owner != this)
+        throw std::invalid_argument("Snapshot belongs to a different database");
+
+    // Waits for reads still using the snapshot. A snapshot that is still set
+    // is in the registry, so close() has not reached it and db is open.
+    std::lock_guard registry_lock(snapshots_mutex);
+    std::unique_lock lock(snapshot.mutex);
+    if (snapshot.snapshot == nullptr)
+        return;
+
+    db->ReleaseSnapshot(snapshot.snapshot);
+    snapshot.snapshot = nullptr;
+    snapshots.erase(&snapshot);
+}
+
+std::unique_ptr<TransactionWrapper> DBWrapper::begin_transaction(const rdb::WriteOptions* opts, bool set_snapshot, 
+    int64_t lock_timeout_ms) {
+    rdb::WriteOptions write_options = helper_write_options(opts);
+    std::shared_lock lock(db_mutex);
+    check_open();
+    rdb::Transaction* txn;
+    if (auto txn_db = dynamic_cast<rdb::TransactionDB*>(db.get())) {
+        rdb::TransactionOptions txn_options;
+        txn_options.set_snapshot = set_snapshot;
+        txn_options.lock_timeout = lock_timeout_ms;
+        txn = txn_db->BeginTransaction(write_options, txn_options);
+    }
+    else if (auto txn_db = dynamic_cast<rdb::OptimisticTransactionDB*>(db.get())) {
+        rdb::OptimisticTransactionOptions txn_options;
+        txn_options.set_snapshot = set_snapshot;
+        txn = txn_db->BeginTransaction(write_options, txn_options);
+    }
+    else {
+        throw std::runtime_error("Database was not opened with transactions");
+    }
+    auto wrapper = std::make_unique<TransactionWrapper>(this, db.get(), txn);
+
+    std::lock_guard registry_lock(transactions_mutex);
+    transactions.insert(wrapper.get());
+    return wrapper;
+}
+
+void DBWrapper::release_transaction(TransactionWrapper& txn) {
+    // Deleting an uncommitted transaction rolls it back and drops its locks
+    // and snapshot. One that is still set is in the registry, so db is open.
+    std::lock_guard registry_lock(transactions_mutex);
+    std::lock_guard lock(txn.mutex);
+    txn.txn.reset();
+    transactions.erase(&txn);
 }
 
 void DBWrapper::close() {
-    if(db != nullptr)
-        db->Close();
+    close_db(true);
+}
+
+void DBWrapper::close_db(bool check_pins) {
+    stop_catch_up();
+    // Closing flushes and joins background work; wait for in-flight calls
+    // from other threads without holding the GIL.
+    py::gil_scoped_release release;
+    {
+        // Their threads write the pending batches under db_mutex
+        std::lock_guard registry_lock(writers_mutex);
+        for (GroupCommitWriter* writer : writers)
+            writer->stop();
+        writers.clear();
+    }
+    std::unique_lock lock(db_mutex);
+    // New pins are only made under db_mutex, so the count cannot grow now
+    if (check_pins && db && pins->load() > 0) {
+        throw std::runtime_error("Cannot close the database while " + std::to_string(pins->load()) + 
+                                 " pinned values still reference it");
+    }
+    {
+        // Iterators and scans reference the column family handles destroyed below
+        std::lock_guard registry_lock(iterators_mutex);
+        for (IteratorWrapper* iter : iterators) {
+            std::lock_guard iter_lock(iter->mutex_);
+            iter->iter_.reset();
+            iter->db_.reset();
+        }
+        iterators.clear();
+        for (ParallelScan* scan : scans)
+            scan->stop();
+        scans.clear();
+    }
+    {
+        // RocksDB refuses to close with unreleased snapshots
+        std::lock_guard registry_lock(snapshots_mutex);
+        for (SnapshotWrapper* snapshot : snapshots) {
+            std::unique_lock snapshot_lock(snapshot->mutex);
+            db->ReleaseSnapshot(snapshot->snapshot);
+            snapshot->snapshot = nullptr;
+        }
+        snapshots.clear();
+    }
+    {
+        // Transactions own snapshots and locks of the DB too
+        std::lock_guard registry_lock(transactions_mutex);
+        for (TransactionWrapper* txn : transactions) {
+            std::lock_guard txn_lock(txn->mutex);
+            txn->txn.reset();
+        }
+        transactions.clear();
+    }
+    if (db) {
+        // Handles must be destroyed before the DB. Python-side copies of them
+        // fail check_db from here on, even against a later DB that happens to
+        // be allocated at the same address.
+        std::unique_lock cf_lock(cf_mutex);
+        for (auto& [name, handle] : cfh) {
+            handle.mark_dropped();
+            db->DestroyColumnFamilyHandle(handle.get_cf_handle());
+        }
+        for (rdb::ColumnFamilyHandle* handle : dropped_cfh)
+            db->DestroyColumnFamilyHandle(handle);
+        cfh.clear();
+        dropped_cfh.clear();
+        default_cfh = nullptr;
+    }
     db.reset();
 }
 
 
 
 std::unordered_map<std::string, ColumnFamilyHandle> DBWrapper::list_column_families() {
+    std::shared_lock lock(cf_mutex);
     return( cfh );
 }
 
+std::unordered_map<std::string, ColumnFamilyHandle> DBWrapper::create_column_families(
+    const std::map<std::string, rdb::ColumnFamilyOptions>& column_families) {
+    std::vector<rdb::ColumnFamilyDescriptor> cf_desc;
+    cf_desc.reserve(column_families.size());
+    for (const auto& [name, options] : column_families)
+        cf_desc.emplace_back(name, options);
+
+    std::unordered_map<std::string, ColumnFamilyHandle> rv;
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        std::vector<rdb::ColumnFamilyHandle*> handles;
+        status = db->CreateColumnFamilies(cf_desc, &handles);
+
+        std::unique_lock cf_lock(cf_mutex);
+        for (rdb::ColumnFamilyHandle* handle : handles) {
+            ColumnFamilyHandle wrapped(handle, db.get());
+            cfh.insert_or_assign(handle->GetName(), wrapped);
+            rv.emplace(handle->GetName(), wrapped);
+        }
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to create column families: " + status.ToString());
+    }
+    return rv;
+}
+
+ColumnFamilyHandle DBWrapper::create_column_family(const std::string& name, const rdb::ColumnFamilyOptions& options) {
+    return create_column_families({{name, options}}).at(name);
+}
+
+void DBWrapper::drop_column_family(ColumnFamilyHandle cfh) {
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = db->DropColumnFamily(cfh.get_cf_handle());
+        if (status.ok()) {
+            std::unique_lock cf_lock(cf_mutex);
+            auto it = this->cfh.find(cfh.get_cf_handle()->GetName());
+            if (it != this->cfh.end() && it->second.get_cf_handle() == cfh.get_cf_handle())
+                this->cfh.erase(it);
+            cfh.mark_dropped();
+            dropped_cfh.push_back(cfh.get_cf_handle());
+        }
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to drop column family: " + status.ToString());
+    }
+}
+
+std::unordered_map<std::string, std::string> helper_options_map(const py::dict& options) {
+    std::unordered_map<std::string, std::string> rv;
+    for (const auto& item : options) {
+        std::string value;
+        if (py::isinstance<py::bool_>(item.second))
+            value = item.second.cast<bool>() ? "true" : "false";
+        else
+            value = py::str(item.second);
+        rv.emplace(py::str(item.first), std::move(value));
+    }
+    return rv;
+}
+
+void helper_check_set_options(const rdb::Status& status) {
+    if (status.IsInvalidArgument())
+        throw std::invalid_argument("Failed to set options: " + status.ToString());
+    if (!status.ok())
+        throw std::runtime_error("Failed to set options: " + status.ToString());
+}
+
+void DBWrapper::set_options(ColumnFamilyHandle cfh, const py::dict& options) {
+    auto options_map = helper_options_map(options);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        if(!cfh.check_db(db.get())){
+            throw std::runtime_error("Invalid column family");
+        }
+        status = db->SetOptions(cfh.get_cf_handle(), options_map);
+    }
+    helper_check_set_options(status);
+}
+
+void DBWrapper::set_db_options(const py::dict& options) {
+    auto options_map = helper_options_map(options);
+    rocksdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        check_open();
+        status = db->SetDBOptions(options_map);
+    }
+    helper_check_set_options(status);
+}
+
+rdb::ColumnFamilyOptions DBWrapper::get_options(ColumnFamilyHandle cfh) {
+    std::shared_lock lock(db_mutex);
+    if(!cfh.check_db(db.get())){
+        throw std::runtime_error("Invalid column family");
+    }
+    return rdb::ColumnFamilyOptions(db->GetOptions(cfh.get_cf_handle()));
+}
+
+rdb::DBOptions DBWrapper::get_db_options() {
+    std::shared_lock lock(db_mutex);
+    check_open();
+    return db->GetDBOptions();
+}
+
+std::unordered_map<std::string, std::string> helper_option_strings(const rdb::Status& status, const std::string& opts) {
+    std::unordered_map<std::string, std::string> rv;
+    rdb::Status parse = status.ok() ? rdb::StringToMap(opts, &rv) : status;
+    if (!parse.ok())
+        throw std::runtime_error("Failed to serialize options: " + parse.ToString());
+    return rv;
+}
+
+std::unordered_map<std::string, std::string> DBWrapper::get_option_strings(ColumnFamilyHandle cfh) {
+    rdb::ColumnFamilyOptions options = get_options(cfh);
+    std::string opts;
+    rdb::Status status = rdb::GetStringFromColumnFamilyOptions(rdb::ConfigOptions(), options, &opts);
+    return helper_option_strings(status, opts);
+}
+
+std::unordered_map<std::string, std::string> DBWrapper::get_db_option_strings() {
+    rdb::DBOptions options = get_db_options();
+    std::string opts;
+    rdb::Status status = rdb::GetStringFromDBOptions(rdb::ConfigOptions(), options, &opts);
+    return helper_option_strings(status, opts);
+}
+
+// Caller holds db_mutex
+rdb::ColumnFamilyHandle* DBWrapper::property_cf(std::optional<ColumnFamilyHandle> cfh) const {
+    check_open();
+    if (!cfh)
+        return default_cfh;
+    if(!cfh->check_db(db.get())){
+        throw std::runtime_error("Invalid column family");
+    }
+    return cfh->get_cf_handle();
+}
+
+std::optional<std::string> DBWrapper::get_property(const std::string& name, std::optional<ColumnFamilyHandle> cfh) {
+    std::string value;
+    bool found;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        found = db->GetProperty(property_cf(cfh), name, &value);
+    }
+    if (!found)
+        return std::nullopt;
+    return value;
+}
+
+std::optional<uint64_t> DBWrapper::get_int_property(const std::string& name, std::optional<ColumnFamilyHandle> cfh) {
+    uint64_t value = 0;
+    bool found;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        found = db->GetIntProperty(property_cf(cfh), name, &value);
+    }
+    if (!found)
+        return std::nullopt;
+    return value;
+}
+
+std::optional<std::map<std::string, std::string>> DBWrapper::get_map_property(const std::string& name, std::optional<ColumnFamilyHandle> cfh) {
+    std::map<std::string, std::string> value;
+    bool found;
+    {
+        py::gil_scoped_release release;
+        std::shared_lock lock(db_mutex);
+        found = db->GetMapProperty(property_cf(cfh), name, &value);
+    }
+    if (!found)
+        return std::nullopt;
+    return value;
+}
+
 
 //static
 //should probably return status, pass column family results by reference?
@@ -204,7 +1045,12 @@ std::vector<std::string>* DBWrapper::get_column_families(const std::string& dbna
     vecst* results = new vecst();
 
 //options, &string name, std::vector<std::string>*- not unique pointer.
-    auto sts = rdb::DB::ListColumnFamilies( db_options, dbname, results );
+    rocksdb::Status sts;
+    {
+        // Reads the MANIFEST
+        py::gil_scoped_release release;
+        sts = rdb::DB::ListColumnFamilies( db_options, dbname, results );
+    }
 //todo: check status...
 
     return(results);//.
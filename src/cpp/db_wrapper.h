@@ -6,11 +6,22 @@
 #include <pybind11/stl.h>
 #include <string>
 #include <memory>
+#include <map>
 #include <optional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "cf_handle.h"
 #include "iterator_wrapper.h"
 #include "batch_wrapper.h"
+#include "snapshot_wrapper.h"
+#include "read_options.h"
+#include "transaction_wrapper.h"
+#include "pinned_value.h"
 #include "db_open_types.h"
 
 namespace py  = pybind11;
@@ -18,6 +29,9 @@ namespace rdb = rocksdb;
 
 typedef std::vector<std::string> vecst;
 
+class ParallelScan;
+class GroupCommitWriter;
+
 class DBWrapper {
 public:
     ~DBWrapper();
@@ -25,22 +39,98 @@ public:
         const rdb::DBOptions& db_options,  py::object& column_families, const DbOpenBase& access_type);
     
     ColumnFamilyHandle get_column_family(const char* name);
-    void put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value);
-    std::optional<py::bytes> get(ColumnFamilyHandle cfh, const py::bytes& key);
-    void delete_key(ColumnFamilyHandle cfh, const py::bytes& key);
-    void write(const WriteBatchWrapper& batch);
+    void put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, const rdb::WriteOptions* opts);
+    std::optional<py::bytes> get(ColumnFamilyHandle cfh, const py::bytes& key, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts);
+    std::unique_ptr<PinnedValue> get_pinned(ColumnFamilyHandle cfh, const py::bytes& key, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts);
+    py::list multi_get(ColumnFamilyHandle cfh, const std::vector<py::bytes>& keys, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts);
+    py::list multi_get_cf(const std::vector<ColumnFamilyHandle>& cfhs, const std::vector<py::bytes>& keys, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts);
+    void merge(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, const rdb::WriteOptions* opts);
+    void delete_key(ColumnFamilyHandle cfh, const py::bytes& key, const rdb::WriteOptions* opts);
+    // Removes [begin, end) with a single range tombstone
+    void delete_range(ColumnFamilyHandle cfh, const py::bytes& begin, const py::bytes& end, const rdb::WriteOptions* opts);
+    // Drops the SST files that lie entirely inside the range, without writing
+    // tombstones. Keys in memtables and partially covered files are kept.
+    void delete_files_in_range(ColumnFamilyHandle cfh, const std::optional<py::bytes>& begin, const std::optional<py::bytes>& end, bool include_end);
+    void write(const WriteBatchWrapper& batch, const rdb::WriteOptions* opts);
+
+    void ingest_external_file(const std::vector<std::string>& paths, ColumnFamilyHandle cfh, bool move_files, 
+        bool snapshot_consistency, bool allow_global_seqno, bool ingest_behind);
+
+    void compact_range(const rdb::CompactRangeOptions& opt, const std::optional<py::bytes>& from_key, const std::optional<py::bytes>& to_key,
+        std::optional<ColumnFamilyHandle> cfh);
+
+    // Flush the memtables of the given column families (all if none), as one
+    // atomic flush if DBOptions.atomic_flush is set
+    void flush(const std::optional<std::vector<ColumnFamilyHandle>>& cfhs, bool wait, bool allow_write_stall);
+    void flush_wal(bool sync);
+    // Wait until no flush or compaction is running or pending. Returns false
+    // if timeout_ms (0 for none) passed first.
+    bool wait_for_compact(bool flush, bool abort_on_pause, uint64_t timeout_ms);
+    void pause_background_work();
+    void continue_background_work();
+    void enable_auto_compaction(const std::optional<std::vector<ColumnFamilyHandle>>& cfhs);
+
+    std::unique_ptr<IteratorWrapper> create_iterator(ColumnFamilyHandle cfh, const IteratorOptions& opts, SnapshotWrapper* snapshot, const ReadOptionsWrapper* read_opts);
 
-    void compact_range(const rdb::CompactRangeOptions& opt, const std::optional<py::bytes>& from_key, const std::optional<py::bytes>& to_key);
+    // Only for databases opened with DbOpenSecondary
+    void try_catch_up_with_primary();
+    // Catch up every interval_ms on a native thread until stopped or closed
+    void start_catch_up(uint32_t interval_ms);
+    void stop_catch_up();
 
-    std::unique_ptr<IteratorWrapper> create_iterator(ColumnFamilyHandle cfh);
+    // Only for databases opened with DbOpenTTL
+    void set_ttl(ColumnFamilyHandle cfh, int32_t ttl);
 
-    const rdb::Snapshot* create_snapshot();
-    void release_snapshot(const rdb::Snapshot* snapshot);
+    // Consistent copy of the DB in a new directory. SST files are hard-linked
+    // when on the same filesystem; the WAL is flushed first if it is larger
+    // than log_size_for_flush, otherwise copied (0 always flushes).
+    void create_checkpoint(const std::string& checkpoint_dir, uint64_t log_size_for_flush);
+
+    std::unique_ptr<SnapshotWrapper> create_snapshot();
+    void release_snapshot(SnapshotWrapper& snapshot);
+
+    // Only for databases opened with DbOpenTransaction or
+    // DbOpenOptimisticTransaction. lock_timeout_ms < 0 uses the DB default and
+    // is ignored by optimistic transactions.
+    std::unique_ptr<TransactionWrapper> begin_transaction(const rdb::WriteOptions* opts, bool set_snapshot, int64_t lock_timeout_ms);
+    void release_transaction(TransactionWrapper& txn);
+
+    // Close an iterator or parallel scan and forget it
+    void release_iterator(IteratorWrapper& iter);
+    void release_scan(ParallelScan& scan);
+    // Stop a group commit writer and forget it; call without the GIL
+    void release_writer(GroupCommitWriter& writer);
     
+    // Stops the group commit writers, closes the open iterators and parallel
+    // scans and releases snapshots and transactions. Raises while PinnedValues still reference the DB, since
+    // they would keep it (and its LOCK file) open.
     void close();
 
     std::unordered_map<std::string, ColumnFamilyHandle> list_column_families();
 
+    // Creates all column families in one call and returns their handles. On
+    // failure the ones that were created are still registered.
+    std::unordered_map<std::string, ColumnFamilyHandle> create_column_families(const std::map<std::string, rdb::ColumnFamilyOptions>& column_families);
+    ColumnFamilyHandle create_column_family(const std::string& name, const rdb::ColumnFamilyOptions& options);
+    // Every copy of the handle becomes invalid; the RocksDB handle itself is
+    // kept until close() so that concurrent calls still using it stay safe.
+    void drop_column_family(ColumnFamilyHandle cfh);
+
+    // Change mutable options of a live DB, e.g. {"write_buffer_size": 64 << 20}.
+    // Values are passed to RocksDB as strings; bools become "true"/"false".
+    void set_options(ColumnFamilyHandle cfh, const py::dict& options);
+    void set_db_options(const py::dict& options);
+    rdb::ColumnFamilyOptions get_options(ColumnFamilyHandle cfh);
+    rdb::DBOptions get_db_options();
+    // Current options as the strings SetOptions/SetDBOptions accept, for saving and restoring them
+    std::unordered_map<std::string, std::string> get_option_strings(ColumnFamilyHandle cfh);
+    std::unordered_map<std::string, std::string> get_db_option_strings();
+
+    // Return std::nullopt when the property is unknown to RocksDB
+    std::optional<std::string> get_property(const std::string& name, std::optional<ColumnFamilyHandle> cfh);
+    std::optional<uint64_t> get_int_property(const std::string& name, std::optional<ColumnFamilyHandle> cfh);
+    std::optional<std::map<std::string, std::string>> get_map_property(const std::string& name, std::optional<ColumnFamilyHandle> cfh);
+
 
 //std::unique_ptr<std::vector<std::string>>
 //std::vector<std::string>*
@@ -48,10 +138,67 @@ public:
     static std::vector<std::string>* get_column_families(const std::string& dbname, const rdb::DBOptions& db_options);
     
 private:
-    DBWrapper(rdb::DB* db, const std::vector<rdb::ColumnFamilyDescriptor>& cf_desc, const std::vector<rdb::ColumnFamilyHandle*>& handles);
+    // Run requests on their own threads, without the GIL
+    friend class AsyncExecutor;
+    friend class GroupCommitWriter;
+    friend class BackupEngineWrapper;
+    friend class ParallelScan;
+
+    // `env` is kept alive until the DB is deleted, for Envs owned by Python
+    DBWrapper(rdb::DB* db, const std::vector<rdb::ColumnFamilyDescriptor>& cf_desc, const std::vector<rdb::ColumnFamilyHandle*>& handles,
+        std::shared_ptr<rdb::Env> env);
+
+    void check_open() const { if(!db) throw std::runtime_error("Database is closed"); }
+    rdb::ColumnFamilyHandle* property_cf(std::optional<ColumnFamilyHandle> cfh) const;
+    // All open column families if cfhs is not given; call with db_mutex held
+    std::vector<rdb::ColumnFamilyHandle*> resolve_cfs(const std::optional<std::vector<ColumnFamilyHandle>>& cfhs) const;
+    std::shared_lock<std::shared_mutex> use_snapshot(SnapshotWrapper* snapshot, rdb::ReadOptions& read_options) const;
+    // The destructor cannot raise, so it leaves the DB to the last PinnedValue
+    void close_db(bool check_pins);
 
-    std::unique_ptr<rdb::DB> db;
+    std::shared_ptr<rdb::DB> db;
     std::unordered_map<std::string, ColumnFamilyHandle> cfh;
     rdb::ColumnFamilyHandle* default_cfh;
+    // Handles of dropped column families, destroyed by close()
+    std::vector<rdb::ColumnFamilyHandle*> dropped_cfh;
+    // Guards cfh and dropped_cfh, which change while the DB is open. Taken
+    // after db_mutex.
+    mutable std::shared_mutex cf_mutex;
+
+    // Guards `db` against close() while other threads are inside RocksDB with
+    // the GIL released. It is never held while (re)acquiring the GIL, so it
+    // cannot deadlock against it.
+    mutable std::shared_mutex db_mutex;
+
+    // Background catch-up of a secondary. The thread takes db_mutex like any
+    // other caller, so it is stopped before close() locks it exclusively.
+    std::thread catch_up_thread;
+    std::mutex catch_up_mutex;
+    std::condition_variable catch_up_cv;
+    bool catch_up_stop = false;
+
+    // Live snapshots, released by close(). Lock order is db_mutex, then
+    // snapshots_mutex, then the snapshot's own mutex.
+    std::unordered_set<SnapshotWrapper*> snapshots;
+    std::mutex snapshots_mutex;
+
+    // Live transactions, rolled back by close(). Lock order is db_mutex, then
+    // transactions_mutex, then the transaction's own mutex.
+    std::unordered_set<TransactionWrapper*> transactions;
+    std::mutex transactions_mutex;
+
+    // Live iterators and parallel scans, closed by close(). Lock order is
+    // db_mutex, then iterators_mutex, then the iterator's or scan's own locks.
+    std::unordered_set<IteratorWrapper*> iterators;
+    std::unordered_set<ParallelScan*> scans;
+    std::mutex iterators_mutex;
+
+    // Live group commit writers, stopped by close() before it takes db_mutex,
+    // since their thread needs it to write the last batch. Lock order is
+    // writers_mutex, then the writer's mutex.
+    std::unordered_set<GroupCommitWriter*> writers;
+    std::mutex writers_mutex;
+
+    PinCount pins = std::make_shared<std::atomic<size_t>>(0);
 
 };
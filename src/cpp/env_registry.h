@@ -0,0 +1,51 @@
+#pragma once
+#include <rocksdb/env.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// DBOptions only holds a raw Env pointer. Envs set from Python are recorded
+// here with their owner, so that DBWrapper::open can keep them alive for the
+// lifetime of the DB and DBOptions.env can return them.
+class EnvRegistry {
+public:
+    static void add(const std::shared_ptr<rocksdb::Env>& env) {
+        if (!env || env.get() == rocksdb::Env::Default())
+            return;
+        std::lock_guard lock(mutex());
+        auto& envs = entries();
+        for (auto it = envs.begin(); it != envs.end();) {
+            if (it->second.expired())
+                it = envs.erase(it);
+            else
+                ++it;
+        }
+        envs[env.get()] = env;
+    }
+
+    // The owner of `env`; a non-owning pointer for Env::Default() and Envs not
+    // set from Python, which outlive the DB anyway
+    static std::shared_ptr<rocksdb::Env> get(rocksdb::Env* env) {
+        if (env == nullptr)
+            env = rocksdb::Env::Default();
+        {
+            std::lock_guard lock(mutex());
+            auto it = entries().find(env);
+            if (it != entries().end()) {
+                if (auto owner = it->second.lock())
+                    return owner;
+            }
+        }
+        return std::shared_ptr<rocksdb::Env>(env, [](rocksdb::Env*) {});
+    }
+
+private:
+    static std::mutex& mutex() {
+        static std::mutex m;
+        return m;
+    }
+    static std::unordered_map<rocksdb::Env*, std::weak_ptr<rocksdb::Env>>& entries() {
+        static std::unordered_map<rocksdb::Env*, std::weak_ptr<rocksdb::Env>> m;
+        return m;
+    }
+};
@@ -0,0 +1,156 @@
+#include "group_commit_writer.h"
+#include "db_wrapper.h"
+#include "helpers.h"
+#include <shared_mutex>
+#include <stdexcept>
+
+GroupCommitWriter::GroupCommitWriter(DBWrapper& db, const rdb::WriteOptions* opts, size_t max_bytes, size_t max_count, 
+    uint32_t max_delay_us) : 
+    db(db), write_options(opts ? *opts : rdb::WriteOptions()), max_bytes(max_bytes), max_count(max_count), max_delay(max_delay_us)
+{
+    thread = std::thread(&GroupCommitWriter::run, this);
+    std::lock_guard registry_lock(db.writers_mutex);
+    db.writers.insert(this);
+}
+
+GroupCommitWriter::~GroupCommitWriter() {
+    close();
+}
+
+bool GroupCommitWriter::full() const {
+    return (max_count && static_cast<size_t>(current->batch.Count()) >= max_count) ||
+           (max_bytes && current->batch.GetDataSize() >= max_bytes);
+}
+
+void GroupCommitWriter::append(ColumnFamilyHandle& cfh, bool wait, const std::function<rdb::Status(rdb::WriteBatch&)>& op) {
+    std::shared_ptr<PendingBatch> batch;
+    {
+        std::shared_lock db_lock(db.db_mutex);
+        if(!cfh.check_db(db.db.get())) {
+            throw std::runtime_error("Invalid column family");
+        }
+        std::lock_guard lock(mutex);
+        if (stopping)
+            throw std::runtime_error("GroupCommitWriter is closed");
+        if (!current) {
+            current = std::make_shared<PendingBatch>();
+            current->id = next_id++;
+            current->opened = std::chrono::steady_clock::now();
+            wake_cv.notify_one();
+        }
+        rdb::Status status = op(current->batch);
+        if (!status.ok())
+            throw std::runtime_error("Failed to add to batch: " + status.ToString());
+        if (full())
+            wake_cv.notify_one();
+        batch = current;
+        if (wait)
+            batch->waiters++;
+    }
+    if (!wait)
+        return;
+
+    std::unique_lock lock(mutex);
+    done_cv.wait(lock, [&] { return batch->done; });
+    if (!batch->status.ok())
+        throw std::runtime_error("Failed to write batch: " + batch->status.ToString());
+}
+
+void GroupCommitWriter::put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, bool wait) {
+    rdb::Slice key_slice = toslice(key), value_slice = toslice(value);
+    py::gil_scoped_release release;
+    append(cfh, wait, [&](rdb::WriteBatch& batch) { return batch.Put(cfh.get_cf_handle(), key_slice, value_slice); });
+}
+
+void GroupCommitWriter::merge(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, bool wait) {
+    rdb::Slice key_slice = toslice(key), value_slice = toslice(value);
+    py::gil_scoped_release release;
+    append(cfh, wait, [&](rdb::WriteBatch& batch) { return batch.Merge(cfh.get_cf_handle(), key_slice, value_slice); });
+}
+
+void GroupCommitWriter::delete_key(ColumnFamilyHandle cfh, const py::bytes& key, bool wait) {
+    rdb::Slice key_slice = toslice(key);
+    py::gil_scoped_release release;
+    append(cfh, wait, [&](rdb::WriteBatch& batch) { return batch.Delete(cfh.get_cf_handle(), key_slice); });
+}
+
+void GroupCommitWriter::run() {
+    std::unique_lock lock(mutex);
+    for (;;) {
+        wake_cv.wait(lock, [this] { return stopping || current; });
+        if (!current)
+            return;
+        wake_cv.wait_until(lock, current->opened + max_delay, [this] { 
+            return stopping || flush_id >= current->id || full(); 
+        });
+
+        std::shared_ptr<PendingBatch> batch = std::move(current);
+        current.reset();
+        lock.unlock();
+        rdb::Status status;
+        {
+            std::shared_lock db_lock(db.db_mutex);
+            if (db.db)
+                status = db.db->Write(write_options, &batch->batch);
+            else
+                status = rdb::Status::Aborted("Database is closed");
+        }
+        lock.lock();
+
+        batch->status = status;
+        batch->done = true;
+        completed_id = batch->id;
+        batches++;
+        operations += batch->batch.Count();
+        // Waiters raise the error themselves
+        if (!status.ok() && batch->waiters == 0 && unreported.ok())
+            unreported = status;
+        done_cv.notify_all();
+    }
+}
+
+void GroupCommitWriter::flush() {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::unique_lock lock(mutex);
+        uint64_t target = next_id - 1;
+        flush_id = target;
+        wake_cv.notify_one();
+        done_cv.wait(lock, [&] { return completed_id >= target || !thread.joinable(); });
+        status = unreported;
+        unreported = rdb::Status::OK();
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to write batch: " + status.ToString());
+    }
+}
+
+void GroupCommitWriter::close() {
+    py::gil_scoped_release release;
+    db.release_writer(*this);
+}
+
+void GroupCommitWriter::stop() {
+    std::thread stopped;
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+        stopped = std::move(thread);
+        wake_cv.notify_one();
+    }
+    // The thread writes the pending batch before it exits
+    if (stopped.joinable())
+        stopped.join();
+    done_cv.notify_all();
+}
+
+uint64_t GroupCommitWriter::batches_written() const {
+    std::lock_guard lock(mutex);
+    return batches;
+}
+
+uint64_t GroupCommitWriter::operations_written() const {
+    std::lock_guard lock(mutex);
+    return operations;
+}
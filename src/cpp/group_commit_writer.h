@@ -0,0 +1,83 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <rocksdb/db.h>
+#include <rocksdb/write_batch.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "cf_handle.h"
+
+namespace py  = pybind11;
+namespace rdb = rocksdb;
+
+class DBWrapper;
+
+// Collects single-key writes from any number of threads into one open
+// WriteBatch, which a background thread writes once it holds max_count
+// operations or max_bytes of data, or max_delay_us after its first write.
+// While one batch is being written the next one fills up, so concurrent
+// writers share WAL appends (and fsyncs with sync=true).
+//
+// Writes with wait=true return once their batch is written and raise its
+// error; the others return at once and the failure of a batch without
+// waiters is reported by the next flush(). The writer is registered with the
+// DB, which stops it when closed.
+class GroupCommitWriter {
+public:
+    GroupCommitWriter(DBWrapper& db, const rdb::WriteOptions* opts, size_t max_bytes, size_t max_count, uint32_t max_delay_us);
+    ~GroupCommitWriter();
+
+    void put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, bool wait);
+    void merge(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value, bool wait);
+    void delete_key(ColumnFamilyHandle cfh, const py::bytes& key, bool wait);
+
+    // Writes everything added so far and waits for it. Raises the first error
+    // of a batch nobody waited for since the last flush().
+    void flush();
+    // Writes what is pending and stops the background thread; errors are
+    // dropped, call flush() first to see them
+    void close();
+
+    uint64_t batches_written() const;
+    uint64_t operations_written() const;
+
+private:
+    struct PendingBatch {
+        uint64_t id;
+        std::chrono::steady_clock::time_point opened;
+        rdb::WriteBatch batch;
+        bool done = false;
+        rdb::Status status;
+        // Writes that wait for the batch and see its status
+        size_t waiters = 0;
+    };
+
+    void append(ColumnFamilyHandle& cfh, bool wait, const std::function<rdb::Status(rdb::WriteBatch&)>& op);
+    bool full() const;
+    void run();
+    // close() without the GIL, called through DBWrapper::release_writer
+    void stop();
+    friend class DBWrapper;
+
+    DBWrapper& db;
+    const rdb::WriteOptions write_options;
+    const size_t max_bytes, max_count;
+    const std::chrono::microseconds max_delay;
+
+    // Taken after db_mutex when both are needed
+    mutable std::mutex mutex;
+    // Wakes the writer thread: first write of a batch, batch full, flush or close
+    std::condition_variable wake_cv;
+    // Signalled whenever a batch has been written
+    std::condition_variable done_cv;
+    std::shared_ptr<PendingBatch> current;
+    uint64_t next_id = 1, completed_id = 0, flush_id = 0;
+    uint64_t batches = 0, operations = 0;
+    rdb::Status unreported;
+    bool stopping = false;
+    std::thread thread;
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include <pybind11/pybind11.h>
 #include <rocksdb/db.h>
+#include <string>
 
 namespace py = pybind11;
 
@@ -13,3 +14,59 @@ inline rocksdb::Slice toslice(const py::bytes& v) {
     }
     return rocksdb::Slice(buffer, length);
 }
+
+// Takes the value out of a PinnableSlice so it no longer references RocksDB
+// memory, copying only when it still pins a block.
+inline std::string unpin(rocksdb::PinnableSlice& slice) {
+    std::string out;
+    if (slice.IsPinned())
+        out.assign(slice.data(), slice.size());
+    else
+        out.swap(*slice.GetSelf());
+    slice.Reset();
+    return out;
+}
+
+// Borrows the bytes of a bytes object or of any C-contiguous buffer
+// (bytearray, memoryview, numpy array, ...) without copying them, keeping
+// the object alive; a str is taken as its UTF-8 encoding. It must be
+// destroyed while the GIL is held.
+class BufferSlice {
+public:
+    explicit BufferSlice(const py::handle& obj) {
+        if (PyBytes_Check(obj.ptr())) {
+            owner = py::reinterpret_borrow<py::object>(obj);
+            slice = toslice(py::reinterpret_borrow<py::bytes>(obj));
+            return;
+        }
+        if (PyUnicode_Check(obj.ptr())) {
+            // The encoding is cached in the str, so it lives as long as owner
+            Py_ssize_t length;
+            const char* buffer = PyUnicode_AsUTF8AndSize(obj.ptr(), &length);
+            if (buffer == nullptr)
+                throw py::error_already_set();
+            owner = py::reinterpret_borrow<py::object>(obj);
+            slice = rocksdb::Slice(buffer, length);
+            return;
+        }
+        if (PyObject_GetBuffer(obj.ptr(), &view, PyBUF_C_CONTIGUOUS) != 0)
+            throw py::error_already_set();
+        has_view = true;
+        slice = rocksdb::Slice(static_cast<const char*>(view.buf), view.len);
+    }
+    ~BufferSlice() {
+        if (has_view)
+            PyBuffer_Release(&view);
+    }
+    BufferSlice(const BufferSlice&) = delete;
+    BufferSlice& operator=(const BufferSlice&) = delete;
+
+    const rocksdb::Slice& get() const { return slice; }
+    const Py_buffer& buffer() const { return view; }
+
+private:
+    rocksdb::Slice slice;
+    py::object owner;
+    Py_buffer view{};
+    bool has_view = false;
+};
@@ -0,0 +1,18 @@
+#pragma once
+#include <rocksdb/options.h>
+#include <optional>
+#include <string>
+
+// Per-iterator read options. Unlike rocksdb::ReadOptions the bounds are owned
+// here, so the IteratorWrapper can keep them alive as long as the iterator.
+// The other fields override the caller's ReadOptions only when set.
+struct IteratorOptions {
+    std::optional<std::string> lower_bound;
+    std::optional<std::string> upper_bound;
+    std::optional<bool> prefix_same_as_start;
+    std::optional<bool> total_order_seek;
+    std::optional<size_t> readahead_size;
+    std::optional<bool> fill_cache;
+    std::optional<bool> auto_readahead_size;
+    std::optional<bool> pin_data;
+};
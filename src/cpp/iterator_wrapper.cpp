@@ -1,51 +1,232 @@
 #include "iterator_wrapper.h"
+#include "db_wrapper.h"
 #include "helpers.h"
 #include <stdexcept>
+#include <string>
+#include <vector>
 
-IteratorWrapper::IteratorWrapper(rocksdb::Iterator* iter) : iter_(iter) {}
+IteratorWrapper::IteratorWrapper(DBWrapper* owner, std::shared_ptr<rocksdb::DB> db, rocksdb::ColumnFamilyHandle* cfh, 
+    const IteratorOptions& opts, rocksdb::ReadOptions read_options, PinCount pins) : 
+    owner_(owner), db_(std::move(db)), pins_(std::move(pins)), opts_(opts) {
+    if (opts_.lower_bound) {
+        lower_bound_ = rocksdb::Slice(*opts_.lower_bound);
+        read_options.iterate_lower_bound = &lower_bound_;
+    }
+    if (opts_.upper_bound) {
+        upper_bound_ = rocksdb::Slice(*opts_.upper_bound);
+        read_options.iterate_upper_bound = &upper_bound_;
+    }
+    if (opts_.prefix_same_as_start)
+        read_options.prefix_same_as_start = *opts_.prefix_same_as_start;
+    if (opts_.total_order_seek)
+        read_options.total_order_seek = *opts_.total_order_seek;
+    if (opts_.readahead_size)
+        read_options.readahead_size = *opts_.readahead_size;
+    if (opts_.fill_cache)
+        read_options.fill_cache = *opts_.fill_cache;
+    if (opts_.auto_readahead_size)
+        read_options.auto_readahead_size = *opts_.auto_readahead_size;
+    if (opts_.pin_data)
+        read_options.pin_data = *opts_.pin_data;
+    pin_data_ = read_options.pin_data;
+
+    iter_.reset(db_->NewIterator(read_options, cfh));
+}
+
+IteratorWrapper::~IteratorWrapper() {
+    close();
+}
+
+void IteratorWrapper::close() {
+    owner_->release_iterator(*this);
+}
 
 void IteratorWrapper::seek_to_first() {
+    py::gil_scoped_release release;
+    std::lock_guard lock(mutex_);
     check_db();
     iter_->SeekToFirst();
 }
 
 void IteratorWrapper::seek_to_last() {
+    py::gil_scoped_release release;
+    std::lock_guard lock(mutex_);
     check_db();
     iter_->SeekToLast();
 }
 
 void IteratorWrapper::seek(const py::bytes& key) {
+    rocksdb::Slice key_slice = toslice(key);
+    py::gil_scoped_release release;
+    std::lock_guard lock(mutex_);
     check_db();
-    iter_->Seek(toslice(key));
+    iter_->Seek(key_slice);
 }
 
 bool IteratorWrapper::valid() const {
+    std::lock_guard lock(mutex_);
     check_db();
     return iter_->Valid();
 }
 
 void IteratorWrapper::next() {
+    py::gil_scoped_release release;
+    std::lock_guard lock(mutex_);
     check_db();
     iter_->Next();
 }
 
 void IteratorWrapper::prev() {
+    py::gil_scoped_release release;
+    std::lock_guard lock(mutex_);
     check_db();
     iter_->Prev();
 }
 
 py::bytes IteratorWrapper::key() const {
+    std::lock_guard lock(mutex_);
     check_db();
-    if (!valid()) {
+    if (!iter_->Valid()) {
         throw std::runtime_error("Iterator not valid");
     }
-    return iter_->key().ToString();
+    rocksdb::Slice key = iter_->key();
+    return py::bytes(key.data(), key.size());
 }
 
 py::bytes IteratorWrapper::value() const {
+    std::lock_guard lock(mutex_);
+    check_db();
+    if (!iter_->Valid()) {
+        throw std::runtime_error("Iterator not valid");
+    }
+    rocksdb::Slice value = iter_->value();
+    return py::bytes(value.data(), value.size());
+}
+
+std::unique_ptr<PinnedValue> IteratorWrapper::value_view() const {
+    std::lock_guard lock(mutex_);
     check_db();
-    if (!valid()) {
+    if (!iter_->Valid()) {
         throw std::runtime_error("Iterator not valid");
     }
-    return iter_->value().ToString();
+
+    // With pin_data, values from SST blocks stay valid until the iterator is
+    // deleted; anything else (e.g. memtable entries) has to be copied once.
+    rocksdb::Slice value = iter_->value();
+    std::string is_pinned;
+    if (pin_data_ && iter_->GetProperty("rocksdb.iterator.is-value-pinned", &is_pinned).ok() && is_pinned == "1")
+        return std::make_unique<PinnedValue>(db_, iter_, value, pins_);
+    return std::make_unique<PinnedValue>(value);
+}
+
+void IteratorWrapper::read_batch(size_t n, size_t max_bytes, bool reverse, bool reposition, KeyValueBatch& out) {
+    std::lock_guard lock(mutex_);
+    check_db();
+    if (reposition) {
+        if (reverse)
+            iter_->SeekToLast();
+        else
+            iter_->SeekToFirst();
+    }
+    read_rows(*iter_, n, max_bytes, reverse, out);
+}
+
+namespace {
+
+// The loop of read_rows and read_columns. `append` adds the current row, or
+// returns false to end the batch before it.
+template <typename Append>
+void helper_read_loop(rocksdb::Iterator& iter, size_t rows, size_t bytes, size_t n, size_t max_bytes, bool reverse, Append&& append) {
+    while (rows < n && iter.Valid()) {
+        rocksdb::Slice key = iter.key(), value = iter.value();
+        if (!append(key, value))
+            break;
+        rows++;
+        bytes += key.size() + value.size();
+        if (reverse)
+            iter.Prev();
+        else
+            iter.Next();
+        // Always return at least one row, even if it alone exceeds max_bytes
+        if (max_bytes && bytes >= max_bytes)
+            break;
+    }
+    if (!iter.status().ok()) {
+        throw std::runtime_error("Iterator failed: " + iter.status().ToString());
+    }
+}
+
+}
+
+void read_rows(rocksdb::Iterator& iter, size_t n, size_t max_bytes, bool reverse, KeyValueBatch& out) {
+    helper_read_loop(iter, out.size(), out.buffer.size(), n, max_bytes, reverse, [&](const rocksdb::Slice& key, const rocksdb::Slice& value) {
+        out.buffer.append(key.data(), key.size());
+        out.key_ends.push_back(out.buffer.size());
+        out.buffer.append(value.data(), value.size());
+        out.value_ends.push_back(out.buffer.size());
+        return true;
+    });
+}
+
+void read_columns(rocksdb::Iterator& iter, size_t n, size_t max_bytes, bool reverse, size_t key_width, bool signed_keys, ColumnarBatch& out) {
+    out.has_int_keys = key_width > 0;
+    helper_read_loop(iter, out.size(), 0, n, max_bytes, reverse, [&](const rocksdb::Slice& key, const rocksdb::Slice& value) {
+        if (key_width) {
+            if (key.size() != key_width) {
+                if (out.size() > 0)
+                    return false;
+                throw std::runtime_error("Key of " + std::to_string(key.size()) + " bytes cannot be decoded as a " + 
+                                         std::to_string(key_width) + "-byte integer");
+            }
+            uint64_t decoded = 0;
+            for (size_t i = 0; i < key_width; i++)
+                decoded = (decoded << 8) | static_cast<uint8_t>(key[i]);
+            if (signed_keys && key_width < 8 && (decoded >> (8 * key_width - 1)) & 1)
+                decoded |= ~uint64_t(0) << (8 * key_width);
+            out.int_keys.push_back(static_cast<int64_t>(decoded));
+        }
+        else {
+            out.key_data.append(key.data(), key.size());
+            out.key_offsets.push_back(static_cast<int64_t>(out.key_data.size()));
+        }
+        out.value_data.append(value.data(), value.size());
+        out.value_offsets.push_back(static_cast<int64_t>(out.value_data.size()));
+        return true;
+    });
+}
+
+std::shared_ptr<ColumnarBatch> IteratorWrapper::next_columnar(size_t n, size_t max_bytes, bool reverse, size_t key_width, bool signed_keys) {
+    if (key_width > 8) {
+        throw std::invalid_argument("key_width must be between 0 and 8");
+    }
+    auto batch = std::make_shared<ColumnarBatch>();
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex_);
+        check_db();
+        read_columns(*iter_, n, max_bytes, reverse, key_width, signed_keys, *batch);
+    }
+    return batch;
+}
+
+py::list IteratorWrapper::next_batch(size_t n, size_t max_bytes, bool reverse) {
+    // Rows are packed into one buffer while stepping without the GIL; the
+    // Python tuples are only built once it is reacquired.
+    KeyValueBatch batch;
+    {
+        py::gil_scoped_release release;
+        read_batch(n, max_bytes, reverse, false, batch);
+    }
+    return batch.to_list();
+}
+
+py::list KeyValueBatch::to_list() const {
+    py::list rv(key_ends.size());
+    size_t start = 0;
+    for (size_t i = 0; i < key_ends.size(); i++) {
+        rv[i] = py::make_tuple(py::bytes(buffer.data() + start, key_ends[i] - start),
+                               py::bytes(buffer.data() + key_ends[i], value_ends[i] - key_ends[i]));
+        start = value_ends[i];
+    }
+    return rv;
 }
@@ -1,15 +1,46 @@
 #pragma once
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <rocksdb/db.h>
 #include <rocksdb/iterator.h>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
+#include "columnar_batch.h"
+#include "iterator_options.h"
+#include "pinned_value.h"
 
 namespace py = pybind11;
 
+class DBWrapper;
+
+// Rows packed into one buffer so they can be collected without the GIL
+struct KeyValueBatch {
+    std::string buffer;
+    std::vector<size_t> key_ends, value_ends;
+
+    size_t size() const { return key_ends.size(); }
+    py::list to_list() const;
+};
+
+// Appends rows from `iter` to `out` until it holds n rows or max_bytes of data
+// (0 for no limit), stepping backwards if reverse; needs no GIL
+void read_rows(rocksdb::Iterator& iter, size_t n, size_t max_bytes, bool reverse, KeyValueBatch& out);
+// Same for the columnar layout. With key_width > 0 keys must be exactly that
+// many bytes and are decoded as big-endian integers, sign-extended if
+// signed_keys. A key of another width ends the batch and stays current, so
+// that no row is lost; it raises once it is the first row of a batch.
+void read_columns(rocksdb::Iterator& iter, size_t n, size_t max_bytes, bool reverse, size_t key_width, bool signed_keys, ColumnarBatch& out);
+
 class IteratorWrapper {
 public:
-    IteratorWrapper(rocksdb::Iterator* iter);
-    ~IteratorWrapper() = default;
+    // The fields set in opts are applied on top of read_options, which carries
+    // the snapshot and the caller's ReadOptions. Like SnapshotWrapper it is
+    // registered with its owner, which closes it when the DB is closed first.
+    IteratorWrapper(DBWrapper* owner, std::shared_ptr<rocksdb::DB> db, rocksdb::ColumnFamilyHandle* cfh, const IteratorOptions& opts,
+        rocksdb::ReadOptions read_options, PinCount pins);
+    ~IteratorWrapper();
     
     void seek_to_first();
     void seek_to_last();
@@ -19,9 +50,30 @@ public:
     void prev();
     py::bytes key() const;
     py::bytes value() const;
+    std::unique_ptr<PinnedValue> value_view() const;
+    py::list next_batch(size_t n, size_t max_bytes, bool reverse);
+    // Same as next_batch, for callers that do not hold the GIL. With `reposition`
+    // the iterator first moves to the start of its range (the end if reverse).
+    void read_batch(size_t n, size_t max_bytes, bool reverse, bool reposition, KeyValueBatch& out);
+    // Like next_batch, but into contiguous buffers instead of Python objects
+    std::shared_ptr<ColumnarBatch> next_columnar(size_t n, size_t max_bytes, bool reverse, size_t key_width, bool signed_keys);
     
     void check_db() const { if(!iter_) throw std::runtime_error("You cannot use this iterator. It has been already closed.");}
-    void close() { iter_.reset(); }
+    void close();
 private:
-    std::unique_ptr<rocksdb::Iterator> iter_;
+    friend class DBWrapper;
+
+    DBWrapper* owner_;
+    // ReadOptions only points at the bounds and the iterator must not outlive
+    // the DB, so all of these are declared before iter_ and outlive it.
+    std::shared_ptr<rocksdb::DB> db_;
+    PinCount pins_;
+    IteratorOptions opts_;
+    rocksdb::Slice lower_bound_, upper_bound_;
+    bool pin_data_ = false;
+    // Shared with the PinnedValues that reference its pinned blocks
+    std::shared_ptr<rocksdb::Iterator> iter_;
+    // Positioning calls run without the GIL; this keeps close() (also from
+    // DBWrapper::close()) from freeing the iterator under them.
+    mutable std::mutex mutex_;
 };
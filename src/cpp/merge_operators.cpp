@@ -0,0 +1,123 @@
+#include "merge_operators.h"
+#include <rocksdb/env.h>
+#include <utility>
+
+namespace {
+
+class UInt64AddOperator : public rocksdb::AssociativeMergeOperator {
+public:
+    bool Merge(const rocksdb::Slice& /*key*/, const rocksdb::Slice* existing_value, const rocksdb::Slice& value, 
+               std::string* new_value, rocksdb::Logger* logger) const override {
+        uint64_t sum = decode(existing_value ? *existing_value : rocksdb::Slice(), logger) + decode(value, logger);
+        new_value->resize(sizeof(sum));
+        for (size_t i = 0; i < sizeof(sum); i++)
+            (*new_value)[i] = static_cast<char>((sum >> (8 * i)) & 0xff);
+        return true;
+    }
+
+    const char* Name() const override { return "pyrocks11.UInt64Add"; }
+
+private:
+    // Like RocksDB's own uint64add, a malformed operand counts as 0 rather than
+    // failing the compaction that meets it
+    static uint64_t decode(const rocksdb::Slice& value, rocksdb::Logger* logger) {
+        if (value.empty())
+            return 0;
+        if (value.size() != sizeof(uint64_t)) {
+            rocksdb::Log(rocksdb::InfoLogLevel::ERROR_LEVEL, logger,
+                         "pyrocks11.UInt64Add: ignoring operand of %zu bytes", value.size());
+            return 0;
+        }
+        uint64_t rv = 0;
+        for (size_t i = 0; i < sizeof(rv); i++)
+            rv |= static_cast<uint64_t>(static_cast<unsigned char>(value[i])) << (8 * i);
+        return rv;
+    }
+};
+
+class MaxOperator : public rocksdb::AssociativeMergeOperator {
+public:
+    bool Merge(const rocksdb::Slice& /*key*/, const rocksdb::Slice* existing_value, const rocksdb::Slice& value, 
+               std::string* new_value, rocksdb::Logger* /*logger*/) const override {
+        const rocksdb::Slice& rv = (existing_value && existing_value->compare(value) >= 0) ? *existing_value : value;
+        new_value->assign(rv.data(), rv.size());
+        return true;
+    }
+
+    const char* Name() const override { return "pyrocks11.Max"; }
+};
+
+class MinOperator : public rocksdb::AssociativeMergeOperator {
+public:
+    bool Merge(const rocksdb::Slice& /*key*/, const rocksdb::Slice* existing_value, const rocksdb::Slice& value, 
+               std::string* new_value, rocksdb::Logger* /*logger*/) const override {
+        const rocksdb::Slice& rv = (existing_value && existing_value->compare(value) <= 0) ? *existing_value : value;
+        new_value->assign(rv.data(), rv.size());
+        return true;
+    }
+
+    const char* Name() const override { return "pyrocks11.Min"; }
+};
+
+class StringAppendOperator : public rocksdb::AssociativeMergeOperator {
+public:
+    explicit StringAppendOperator(std::string delimiter) : delimiter_(std::move(delimiter)) {}
+
+    bool Merge(const rocksdb::Slice& /*key*/, const rocksdb::Slice* existing_value, const rocksdb::Slice& value, 
+               std::string* new_value, rocksdb::Logger* /*logger*/) const override {
+        new_value->clear();
+        if (existing_value) {
+            new_value->reserve(existing_value->size() + delimiter_.size() + value.size());
+            new_value->assign(existing_value->data(), existing_value->size());
+            new_value->append(delimiter_);
+        }
+        new_value->append(value.data(), value.size());
+        return true;
+    }
+
+    const char* Name() const override { return "pyrocks11.StringAppend"; }
+
+private:
+    std::string delimiter_;
+};
+
+class BytesOrOperator : public rocksdb::AssociativeMergeOperator {
+public:
+    bool Merge(const rocksdb::Slice& /*key*/, const rocksdb::Slice* existing_value, const rocksdb::Slice& value, 
+               std::string* new_value, rocksdb::Logger* /*logger*/) const override {
+        if (!existing_value) {
+            new_value->assign(value.data(), value.size());
+            return true;
+        }
+        const rocksdb::Slice& longer = existing_value->size() >= value.size() ? *existing_value : value;
+        const rocksdb::Slice& shorter = existing_value->size() >= value.size() ? value : *existing_value;
+        new_value->assign(longer.data(), longer.size());
+        for (size_t i = 0; i < shorter.size(); i++)
+            (*new_value)[i] |= shorter[i];
+        return true;
+    }
+
+    const char* Name() const override { return "pyrocks11.BytesOr"; }
+};
+
+}
+
+std::shared_ptr<rocksdb::MergeOperator> make_uint64_add_operator() {
+    return std::make_shared<UInt64AddOperator>();
+}
+
+std::shared_ptr<rocksdb::MergeOperator> make_max_operator() {
+    return std::make_shared<MaxOperator>();
+}
+
+std::shared_ptr<rocksdb::MergeOperator> make_min_operator() {
+    return std::make_shared<MinOperator>();
+}
+
+std::shared_ptr<rocksdb::MergeOperator> make_string_append_operator(const std::string& delimiter) {
+    return std::make_shared<StringAppendOperator>(delimiter);
+}
+
+std::shared_ptr<rocksdb::MergeOperator> make_bytes_or_operator() {
+    return std::make_shared<BytesOrOperator>();
+}
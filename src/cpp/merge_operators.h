@@ -0,0 +1,18 @@
+#pragma once
+#include <rocksdb/merge_operator.h>
+#include <memory>
+#include <string>
+
+// Built-in associative merge operators, selected through
+// ColumnFamilyOptions::merge_operator. They run inside RocksDB on reads and
+// compactions and never call back into Python.
+
+// Adds 8-byte little-endian unsigned integers, wrapping on overflow
+std::shared_ptr<rocksdb::MergeOperator> make_uint64_add_operator();
+// Keeps the bytewise largest / smallest value
+std::shared_ptr<rocksdb::MergeOperator> make_max_operator();
+std::shared_ptr<rocksdb::MergeOperator> make_min_operator();
+// Appends values, separated by `delimiter`
+std::shared_ptr<rocksdb::MergeOperator> make_string_append_operator(const std::string& delimiter);
+// ORs values byte by byte; the shorter operand is padded with zero bytes
+std::shared_ptr<rocksdb::MergeOperator> make_bytes_or_operator();
@@ -0,0 +1,369 @@
+#include "parallel_scan.h"
+#include "db_wrapper.h"
+#include <rocksdb/comparator.h>
+#include <rocksdb/metadata.h>
+#include <algorithm>
+#include <shared_mutex>
+#include <stdexcept>
+
+using namespace py::literals;
+
+namespace {
+
+// Up to partitions - 1 keys strictly inside (begin, end) that split it into
+// ranges of roughly equal size. Candidates are the smallest and largest keys
+// of the column family's SST files; the data between neighbouring candidates
+// is estimated with GetApproximateSizes.
+std::vector<std::string> helper_split_points(rdb::DB* db, rdb::ColumnFamilyHandle* cfh, const std::optional<std::string>& begin,
+    const std::optional<std::string>& end, size_t partitions) {
+    std::vector<std::string> keys;
+    if (partitions < 2)
+        return keys;
+
+    const rdb::Comparator* cmp = cfh->GetComparator();
+    std::vector<rdb::LiveFileMetaData> files;
+    db->GetLiveFilesMetaData(&files);
+    for (const auto& file : files) {
+        if (file.column_family_name != cfh->GetName())
+            continue;
+        for (const std::string* key : {&file.smallestkey, &file.largestkey}) {
+            if (begin && cmp->Compare(*key, *begin) <= 0)
+                continue;
+            if (end && cmp->Compare(*key, *end) >= 0)
+                continue;
+            keys.push_back(*key);
+        }
+    }
+    std::sort(keys.begin(), keys.end(), [cmp](const std::string& a, const std::string& b) { return cmp->Compare(a, b) < 0; });
+    keys.erase(std::unique(keys.begin(), keys.end(), [cmp](const std::string& a, const std::string& b) { return cmp->Compare(a, b) == 0; }),
+               keys.end());
+    if (keys.size() < partitions)
+        return keys;
+
+    // sizes[i] estimates the data in [keys[i - 1], keys[i]), with the range
+    // bounds standing in for keys[-1]; an open begin counts as empty
+    std::vector<rdb::Range> ranges;
+    ranges.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (i > 0)
+            ranges.emplace_back(keys[i - 1], keys[i]);
+        else
+            ranges.emplace_back(begin ? rdb::Slice(*begin) : rdb::Slice(keys[0]), keys[0]);
+    }
+    std::vector<uint64_t> sizes(ranges.size());
+    rdb::SizeApproximationOptions size_options;
+    size_options.include_memtables = true;
+    rdb::Status status = db->GetApproximateSizes(size_options, cfh, ranges.data(), static_cast<int>(ranges.size()), sizes.data());
+    if (!status.ok())
+        throw std::runtime_error("Failed to get approximate sizes: " + status.ToString());
+
+    uint64_t total = 0;
+    for (uint64_t size : sizes)
+        total += size;
+
+    // Cut at the first candidate with at least cut * total / partitions of
+    // data before it, or evenly by candidate count if there is nothing to go by
+    std::vector<std::string> splits;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < keys.size() && splits.size() + 1 < partitions; i++) {
+        seen += sizes[i];
+        size_t cut = splits.size() + 1;
+        bool past = total ? seen * partitions >= cut * total : i * partitions >= cut * keys.size();
+        if (past)
+            splits.push_back(keys[i]);
+    }
+    return splits;
+}
+
+}
+
+ParallelScan::ParallelScan(DBWrapper& owner, ColumnFamilyHandle cfh, const std::optional<py::bytes>& begin, const std::optional<py::bytes>& end,
+    size_t partitions, size_t threads, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts, size_t batch_size, size_t max_bytes,
+    bool ordered, size_t max_pending) : owner(&owner), threads(threads), batch_size(batch_size), max_bytes(max_bytes), max_pending(max_pending), ordered(ordered) {
+    if (partitions == 0 || threads == 0)
+        throw std::invalid_argument("ParallelScan needs at least one partition and one thread");
+    if (batch_size == 0 || max_pending == 0)
+        throw std::invalid_argument("batch_size and max_pending must be positive");
+
+    std::optional<std::string> lower, upper;
+    if (begin)
+        lower = std::string(*begin);
+    if (end)
+        upper = std::string(*end);
+    rdb::ReadOptions read_options = opts ? *opts : rdb::ReadOptions();
+
+    py::gil_scoped_release release;
+    std::shared_lock lock(owner.db_mutex);
+    if (!cfh.check_db(owner.db.get())) {
+        throw std::runtime_error("Invalid column family");
+    }
+    db = owner.db;
+
+    std::vector<std::string> splits = helper_split_points(db.get(), cfh.get_cf_handle(), lower, upper, partitions);
+    parts.resize(splits.size() + 1);
+    for (size_t i = 0; i < parts.size(); i++) {
+        parts[i].lower = i == 0 ? lower : splits[i - 1];
+        parts[i].upper = i == splits.size() ? upper : splits[i];
+    }
+
+    // Every iterator pins the snapshot's sequence number when it is created,
+    // so an implicit snapshot is only needed until all of them exist
+    auto snapshot_lock = owner.use_snapshot(helper_snapshot(snapshot, opts), read_options);
+    const rdb::Snapshot* implicit_snapshot = nullptr;
+    if (read_options.snapshot == nullptr)
+        read_options.snapshot = implicit_snapshot = db->GetSnapshot();
+    for (Partition& part : parts) {
+        rdb::ReadOptions part_options = read_options;
+        if (part.lower) {
+            part.lower_slice = rdb::Slice(*part.lower);
+            part_options.iterate_lower_bound = &part.lower_slice;
+        }
+        if (part.upper) {
+            part.upper_slice = rdb::Slice(*part.upper);
+            part_options.iterate_upper_bound = &part.upper_slice;
+        }
+        part.iter.reset(db->NewIterator(part_options, cfh.get_cf_handle()));
+    }
+    if (implicit_snapshot)
+        db->ReleaseSnapshot(implicit_snapshot);
+
+    std::lock_guard registry_lock(owner.iterators_mutex);
+    owner.scans.insert(this);
+}
+
+ParallelScan::~ParallelScan() {
+    close();
+}
+
+py::list ParallelScan::partitions() const {
+    py::list rv(parts.size());
+    for (size_t i = 0; i < parts.size(); i++) {
+        const Partition& part = parts[i];
+        rv[i] = py::make_tuple(part.lower ? py::object(py::bytes(*part.lower)) : py::none(),
+                               part.upper ? py::object(py::bytes(*part.upper)) : py::none());
+    }
+    return rv;
+}
+
+void ParallelScan::start(bool aggregate_rows) {
+    if (stopping)
+        throw std::runtime_error("ParallelScan is closed");
+    if (started)
+        throw std::runtime_error("ParallelScan has already been started");
+    started = true;
+    aggregating = aggregate_rows;
+
+    std::lock_guard lock(workers_mutex);
+    size_t n = std::min(threads, parts.size());
+    workers.reserve(n);
+    for (size_t i = 0; i < n; i++)
+        workers.emplace_back(&ParallelScan::worker, this);
+}
+
+void ParallelScan::worker() {
+    for (;;) {
+        Partition* part;
+        {
+            std::lock_guard lock(mutex);
+            if (stopping || next_partition == parts.size())
+                return;
+            part = &parts[next_partition++];
+        }
+        try {
+            if (aggregating)
+                aggregate_partition(*part);
+            else
+                stream_partition(*part);
+        }
+        catch (const std::exception& e) {
+            {
+                std::lock_guard lock(mutex);
+                if (!error)
+                    error = e.what();
+                stopping = true;
+            }
+            produced.notify_all();
+            consumed.notify_all();
+            return;
+        }
+        finish(*part);
+    }
+}
+
+void ParallelScan::stream_partition(Partition& part) {
+    rdb::Iterator& iter = *part.iter;
+    iter.SeekToFirst();
+    while (iter.Valid()) {
+        KeyValueBatch chunk;
+        read_rows(iter, batch_size, max_bytes, false, chunk);
+        if (!push(part, std::move(chunk)))
+            return;
+    }
+    if (!iter.status().ok()) {
+        throw std::runtime_error("Iterator failed: " + iter.status().ToString());
+    }
+}
+
+void ParallelScan::aggregate_partition(Partition& part) {
+    rdb::Iterator& iter = *part.iter;
+    Stats& stats = part.stats;
+    for (iter.SeekToFirst(); iter.Valid(); iter.Next()) {
+        rdb::Slice key = iter.key();
+        if (stats.count == 0)
+            stats.min_key = key.ToString();
+        stats.count++;
+        stats.key_bytes += key.size();
+        stats.value_bytes += iter.value().size();
+        if (stats.count % 1024 == 0 && stopping)
+            return;
+    }
+    if (!iter.status().ok()) {
+        throw std::runtime_error("Iterator failed: " + iter.status().ToString());
+    }
+    // Partitions are scanned forwards, so the last key is one seek away
+    if (stats.count) {
+        iter.SeekToLast();
+        if (!iter.Valid()) {
+            throw std::runtime_error("Iterator failed: " + iter.status().ToString());
+        }
+        stats.max_key = iter.key().ToString();
+    }
+}
+
+bool ParallelScan::push(Partition& part, KeyValueBatch chunk) {
+    {
+        std::unique_lock lock(mutex);
+        std::deque<KeyValueBatch>& queue = ordered ? part.chunks : ready;
+        // In key order each partition buffers max_pending chunks, so the one
+        // next_chunk() waits for is never blocked by the others
+        size_t limit = ordered ? max_pending : max_pending * threads;
+        consumed.wait(lock, [&] { return stopping || queue.size() < limit; });
+        if (stopping)
+            return false;
+        queue.push_back(std::move(chunk));
+    }
+    produced.notify_all();
+    return true;
+}
+
+void ParallelScan::finish(Partition& part) {
+    {
+        std::lock_guard lock(mutex);
+        part.done = true;
+        finished++;
+    }
+    produced.notify_all();
+}
+
+std::optional<py::list> ParallelScan::next_chunk() {
+    if (!started)
+        start(false);
+    else if (aggregating)
+        throw std::runtime_error("ParallelScan has already been started");
+
+    KeyValueBatch chunk;
+    bool found = false;
+    {
+        py::gil_scoped_release release;
+        std::unique_lock lock(mutex);
+        while (!error && !stopping) {
+            if (ordered) {
+                if (current == parts.size())
+                    break;
+                Partition& part = parts[current];
+                if (!part.chunks.empty()) {
+                    chunk = std::move(part.chunks.front());
+                    part.chunks.pop_front();
+                    found = true;
+                    break;
+                }
+                if (part.done) {
+                    current++;
+                    continue;
+                }
+            }
+            else {
+                if (!ready.empty()) {
+                    chunk = std::move(ready.front());
+                    ready.pop_front();
+                    found = true;
+                    break;
+                }
+                if (finished == parts.size())
+                    break;
+            }
+            produced.wait(lock);
+        }
+        if (error) {
+            throw std::runtime_error(*error);
+        }
+        if (!found && stopping) {
+            throw std::runtime_error("ParallelScan is closed");
+        }
+    }
+    if (!found)
+        return std::nullopt;
+    consumed.notify_all();
+    return chunk.to_list();
+}
+
+py::dict ParallelScan::aggregate() {
+    start(true);
+
+    Stats total;
+    {
+        py::gil_scoped_release release;
+        {
+            std::lock_guard lock(workers_mutex);
+            for (auto& t : workers)
+                t.join();
+            workers.clear();
+        }
+        std::lock_guard lock(mutex);
+        if (error) {
+            throw std::runtime_error(*error);
+        }
+        if (stopping) {
+            throw std::runtime_error("ParallelScan is closed");
+        }
+        for (Partition& part : parts) {
+            if (part.stats.count == 0)
+                continue;
+            if (total.count == 0)
+                total.min_key = std::move(part.stats.min_key);
+            total.max_key = std::move(part.stats.max_key);
+            total.count += part.stats.count;
+            total.key_bytes += part.stats.key_bytes;
+            total.value_bytes += part.stats.value_bytes;
+        }
+    }
+    return py::dict(
+        "count"_a = total.count,
+        "key_bytes"_a = total.key_bytes,
+        "value_bytes"_a = total.value_bytes,
+        "min_key"_a = total.min_key ? py::object(py::bytes(*total.min_key)) : py::none(),
+        "max_key"_a = total.max_key ? py::object(py::bytes(*total.max_key)) : py::none());
+}
+
+void ParallelScan::close() {
+    py::gil_scoped_release release;
+    owner->release_scan(*this);
+}
+
+void ParallelScan::stop() {
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    produced.notify_all();
+    consumed.notify_all();
+
+    std::lock_guard lock(workers_mutex);
+    for (auto& t : workers)
+        t.join();
+    workers.clear();
+    // Iterators go before the DB they belong to
+    for (Partition& part : parts)
+        part.iter.reset();
+    db.reset();
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <rocksdb/db.h>
+#include <rocksdb/iterator.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cf_handle.h"
+#include "iterator_wrapper.h"
+#include "snapshot_wrapper.h"
+#include "read_options.h"
+
+namespace py  = pybind11;
+namespace rdb = rocksdb;
+
+class DBWrapper;
+
+// Scans [begin, end) of one column family on a pool of native threads.
+//
+// The range is split into partitions at SST file boundaries, balanced with
+// GetApproximateSizes, so there are at most as many partitions as there are
+// distinct file boundaries in the range. All partition iterators are created
+// up front from one snapshot - the caller's, or an implicit one - so the
+// partitions together see a single consistent state.
+//
+// A scan is used once, either through next_chunk(), which streams chunks of
+// rows in key order (or in whatever order partitions produce them with
+// ordered=false), or through aggregate(), which folds every row into counts
+// without ever taking the GIL.
+class ParallelScan {
+public:
+    ParallelScan(DBWrapper& db, ColumnFamilyHandle cfh, const std::optional<py::bytes>& begin, const std::optional<py::bytes>& end,
+        size_t partitions, size_t threads, SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts, size_t batch_size, size_t max_bytes,
+        bool ordered, size_t max_pending);
+    ~ParallelScan();
+
+    // (lower, upper) of every partition, None for an open bound
+    py::list partitions() const;
+
+    // The next chunk of (key, value) tuples, or None once the scan is done.
+    // Raises the first error of any partition.
+    std::optional<py::list> next_chunk();
+
+    // Scans everything and returns count, key_bytes, value_bytes, min_key and
+    // max_key (None if the range is empty)
+    py::dict aggregate();
+
+    // Stops the workers; the scan cannot be used afterwards. DBWrapper::close()
+    // closes it too.
+    void close();
+
+private:
+    friend class DBWrapper;
+
+    struct Stats {
+        uint64_t count = 0, key_bytes = 0, value_bytes = 0;
+        std::optional<std::string> min_key, max_key;
+    };
+    struct Partition {
+        std::optional<std::string> lower, upper;
+        rdb::Slice lower_slice, upper_slice;
+        std::unique_ptr<rdb::Iterator> iter;
+        // Streaming in key order: chunks not yet taken by next_chunk()
+        std::deque<KeyValueBatch> chunks;
+        bool done = false;
+        Stats stats;
+    };
+
+    void start(bool aggregating);
+    void worker();
+    void stream_partition(Partition& partition);
+    void aggregate_partition(Partition& partition);
+    // Waits for room in the partition's (or the shared) queue; false if stopping
+    bool push(Partition& partition, KeyValueBatch chunk);
+    void finish(Partition& partition);
+    // close() without the GIL and the owner's registry
+    void stop();
+
+    // Registered with the owner, which outlives it (keep_alive)
+    DBWrapper* owner;
+    // The iterators must not outlive the DB
+    std::shared_ptr<rdb::DB> db;
+    // Never resized after the constructor; the bounds slices point into it
+    std::vector<Partition> parts;
+    size_t threads, batch_size, max_bytes, max_pending;
+    bool ordered;
+
+    // Joined by aggregate() or close(), whichever comes first
+    std::vector<std::thread> workers;
+    std::mutex workers_mutex;
+    bool started = false;
+    bool aggregating = false;
+    std::atomic<bool> stopping{false};
+
+    // Guards the queues, next_partition, current, finished and error
+    std::mutex mutex;
+    std::condition_variable produced, consumed;
+    // Streaming unordered: chunks of any partition, in production order
+    std::deque<KeyValueBatch> ready;
+    size_t next_partition = 0, current = 0, finished = 0;
+    std::optional<std::string> error;
+};
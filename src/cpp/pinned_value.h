@@ -0,0 +1,62 @@
+#pragma once
+#include <rocksdb/db.h>
+#include <rocksdb/iterator.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace rdb = rocksdb;
+
+// Number of live PinnedValues that reference a DB. DBWrapper::close() refuses
+// to close the DB while it is not zero.
+using PinCount = std::shared_ptr<std::atomic<size_t>>;
+
+// A value handed to Python without copying. It keeps whatever owns the bytes
+// alive - a block pinned by Get, the iterator whose blocks are pinned, or its
+// own buffer - together with the DB, for as long as Python references it.
+class PinnedValue {
+public:
+    // Empty value for DB::Get to fill through slice()
+    PinnedValue(std::shared_ptr<rdb::DB> db, PinCount pins) : db(std::move(db)), pins(std::move(pins)) { ++*this->pins; }
+
+    // A value that stays valid for the lifetime of `iter` (ReadOptions::pin_data)
+    PinnedValue(std::shared_ptr<rdb::DB> db, std::shared_ptr<rdb::Iterator> iter, const rdb::Slice& value, PinCount pins) :
+        db(std::move(db)), iter(std::move(iter)), pins(std::move(pins)), view(value) { ++*this->pins; }
+
+    // A value that could not be pinned; keeps a copy
+    explicit PinnedValue(const rdb::Slice& value) { pinned.PinSelf(value); }
+
+    ~PinnedValue() { unpin(); }
+
+    PinnedValue(const PinnedValue&) = delete;
+    PinnedValue& operator=(const PinnedValue&) = delete;
+
+    rdb::PinnableSlice* slice() { return &pinned; }
+
+    // After Get: a value that was copied into the slice's own buffer (e.g.
+    // the result of a merge) needs no reference to the DB
+    void release_if_copied() {
+        if (!iter && !pinned.IsPinned()) {
+            unpin();
+            db.reset();
+        }
+    }
+
+    const char* data() const { return iter ? view.data() : pinned.data(); }
+    size_t size() const { return iter ? view.size() : pinned.size(); }
+
+private:
+    void unpin() {
+        if (pins) {
+            --*pins;
+            pins.reset();
+        }
+    }
+
+    // Declared first so the DB outlives the pins released below
+    std::shared_ptr<rdb::DB> db;
+    std::shared_ptr<rdb::Iterator> iter;
+    PinCount pins;
+    rdb::PinnableSlice pinned;
+    rdb::Slice view;
+};
@@ -0,0 +1,23 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <rocksdb/options.h>
+#include "snapshot_wrapper.h"
+
+namespace py = pybind11;
+
+// rocksdb::ReadOptions as exposed to Python. A snapshot set on it is kept as
+// the Python object rather than in ReadOptions::snapshot, so it lives as long
+// as the options and every read still checks, through DBWrapper::use_snapshot,
+// that it has not been released. Reads copy only the rocksdb::ReadOptions part.
+struct ReadOptionsWrapper : public rocksdb::ReadOptions {
+    // The object that was set (a Snapshot or cSnapshot) and its native handle
+    py::object snapshot_object = py::none();
+    SnapshotWrapper* snapshot_handle = nullptr;
+};
+
+// The snapshot a read uses: the one passed to the call, else the one set on opts
+inline SnapshotWrapper* helper_snapshot(SnapshotWrapper* snapshot, const ReadOptionsWrapper* opts) {
+    if (snapshot == nullptr && opts != nullptr)
+        return opts->snapshot_handle;
+    return snapshot;
+}
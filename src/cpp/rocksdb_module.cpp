@@ -1,11 +1,34 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <rocksdb/table.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/perf_level.h>
+#include <rocksdb/perf_context.h>
+#include <rocksdb/iostats_context.h>
 #include "db_wrapper.h"
 #include "iterator_wrapper.h"
+#include "iterator_options.h"
+#include "read_options.h"
 #include "batch_wrapper.h"
+#include "snapshot_wrapper.h"
+#include "transaction_wrapper.h"
+#include "async_executor.h"
+#include "group_commit_writer.h"
+#include "backup_engine_wrapper.h"
+#include "parallel_scan.h"
+#include "pinned_value.h"
+#include "columnar_batch.h"
 #include "cf_handle.h"
 #include "db_open_types.h"
+#include "stats_helpers.h"
+#include "sst_file_writer_wrapper.h"
+#include "merge_operators.h"
+#include "compaction_filters.h"
+#include "mock_time_env.h"
+#include "env_registry.h"
 
 namespace py = pybind11;
 using namespace py::literals;
@@ -81,6 +104,63 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
 
     py::class_<ColumnFamilyHandle>(m, "cCFHandle");
 
+    // RocksDB hands these out as pointers to const; they are immutable, but
+    // pybind11 holders cannot be pointer-to-const, hence the const_casts.
+    py::class_<rocksdb::FilterPolicy, std::shared_ptr<rocksdb::FilterPolicy>>(m, "FilterPolicy")
+        .def_static("bloom", [](double bits_per_key) {
+            return std::shared_ptr<rocksdb::FilterPolicy>(const_cast<rocksdb::FilterPolicy*>(rocksdb::NewBloomFilterPolicy(bits_per_key)));
+        }, "bits_per_key"_a = 10.0)
+        .def_static("ribbon", [](double bloom_equivalent_bits_per_key, int bloom_before_level) {
+            return std::shared_ptr<rocksdb::FilterPolicy>(const_cast<rocksdb::FilterPolicy*>(
+                rocksdb::NewRibbonFilterPolicy(bloom_equivalent_bits_per_key, bloom_before_level)));
+        }, "bloom_equivalent_bits_per_key"_a = 10.0, "bloom_before_level"_a = 0)
+        .def_property_readonly("name", [](const rocksdb::FilterPolicy& self) {
+            return std::string(self.Name());
+        });
+
+    py::class_<rocksdb::SliceTransform, std::shared_ptr<rocksdb::SliceTransform>>(m, "PrefixExtractor")
+        .def_static("fixed", [](size_t prefix_len) {
+            return std::shared_ptr<rocksdb::SliceTransform>(const_cast<rocksdb::SliceTransform*>(rocksdb::NewFixedPrefixTransform(prefix_len)));
+        }, "prefix_len"_a)
+        .def_static("capped", [](size_t cap_len) {
+            return std::shared_ptr<rocksdb::SliceTransform>(const_cast<rocksdb::SliceTransform*>(rocksdb::NewCappedPrefixTransform(cap_len)));
+        }, "cap_len"_a)
+        .def_property_readonly("name", [](const rocksdb::SliceTransform& self) {
+            return std::string(self.Name());
+        });
+
+    py::class_<rocksdb::MergeOperator, std::shared_ptr<rocksdb::MergeOperator>>(m, "MergeOperator")
+        .def_static("uint64_add", &make_uint64_add_operator)
+        .def_static("max", &make_max_operator)
+        .def_static("min", &make_min_operator)
+        .def_static("string_append", &make_string_append_operator, "delimiter"_a = ",")
+        .def_static("bytes_or", &make_bytes_or_operator)
+        .def_property_readonly("name", [](const rocksdb::MergeOperator& self) {
+            return std::string(self.Name());
+        });
+
+    py::class_<rocksdb::CompactionFilterFactory, std::shared_ptr<rocksdb::CompactionFilterFactory>>(m, "CompactionFilter")
+        .def_static("drop_prefixes", &make_drop_prefixes_filter, "prefixes"_a)
+        .def_static("expiry", [](size_t offset, size_t width, bool big_endian, bool milliseconds, std::shared_ptr<rocksdb::Env> env) {
+            return make_expiry_filter(offset, width, big_endian, milliseconds, std::move(env));
+        }, "offset"_a = 0, "width"_a = 8, "big_endian"_a = true, "milliseconds"_a = false, "env"_a = py::none())
+        .def_static("keep_latest_versions", &make_keep_latest_versions_filter, "n"_a, "prefix_len"_a, "key_prefix"_a = "")
+        .def_property_readonly("name", [](const rocksdb::CompactionFilterFactory& self) {
+            return std::string(self.Name());
+        })
+        .def_property_readonly("processed", [](const rocksdb::CompactionFilterFactory& self) -> uint64_t {
+            auto counting = dynamic_cast<const CountingFilterFactory*>(&self);
+            return counting ? counting->processed() : 0;
+        })
+        .def_property_readonly("dropped", [](const rocksdb::CompactionFilterFactory& self) -> uint64_t {
+            auto counting = dynamic_cast<const CountingFilterFactory*>(&self);
+            return counting ? counting->dropped() : 0;
+        })
+        .def("reset_counters", [](rocksdb::CompactionFilterFactory& self) {
+            if (auto counting = dynamic_cast<CountingFilterFactory*>(&self))
+                counting->reset_counters();
+        });
+
     py::class_<rocksdb::ColumnFamilyOptions>(m, "cCFOptions")
         .def(py::init())
         .def("optimize_level_style_compaction", [](rocksdb::ColumnFamilyOptions& self, int memtable_memory_budget = 512 * 1024 * 1024) {
@@ -92,10 +172,21 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
             self.OptimizeForSmallDb();
             return py::none();
         })
+        // The column family half of Options::PrepareForBulkLoad
+        .def("prepare_for_bulk_load", [](rocksdb::ColumnFamilyOptions& self) {
+            rocksdb::Options options(rocksdb::DBOptions(), self);
+            options.PrepareForBulkLoad();
+            self = rocksdb::ColumnFamilyOptions(options);
+            return py::none();
+        })
         .def("set_plain_table", [](rocksdb::ColumnFamilyOptions& self, const rocksdb::PlainTableOptions& pto) {
           self.table_factory.reset(NewPlainTableFactory(pto));
           return py::none();
         })
+        .def("set_block_based_table", [](rocksdb::ColumnFamilyOptions& self, const rocksdb::BlockBasedTableOptions& bbto) {
+          self.table_factory.reset(NewBlockBasedTableFactory(bbto));
+          return py::none();
+        })
         .def_readwrite("enable_blob_files", &rocksdb::ColumnFamilyOptions::enable_blob_files)
         .def_readwrite("enable_blob_garbage_collection", &rocksdb::ColumnFamilyOptions::enable_blob_garbage_collection)
         .def_readwrite("min_blob_size", &rocksdb::ColumnFamilyOptions::min_blob_size)
@@ -106,7 +197,27 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
         .def_readwrite("write_buffer_size", &rocksdb::ColumnFamilyOptions::write_buffer_size)
         .def_readwrite("level0_file_num_compaction_trigger", &rocksdb::ColumnFamilyOptions::level0_file_num_compaction_trigger)
         .def_readwrite("max_bytes_for_level_base", &rocksdb::ColumnFamilyOptions::max_bytes_for_level_base)
+        .def_readwrite("level0_slowdown_writes_trigger", &rocksdb::ColumnFamilyOptions::level0_slowdown_writes_trigger)
+        .def_readwrite("level0_stop_writes_trigger", &rocksdb::ColumnFamilyOptions::level0_stop_writes_trigger)
+        .def_readwrite("soft_pending_compaction_bytes_limit", &rocksdb::ColumnFamilyOptions::soft_pending_compaction_bytes_limit)
+        .def_readwrite("hard_pending_compaction_bytes_limit", &rocksdb::ColumnFamilyOptions::hard_pending_compaction_bytes_limit)
+        .def_readwrite("max_compaction_bytes", &rocksdb::ColumnFamilyOptions::max_compaction_bytes)
+        .def_readwrite("max_write_buffer_number", &rocksdb::ColumnFamilyOptions::max_write_buffer_number)
+        .def_readwrite("target_file_size_base", &rocksdb::ColumnFamilyOptions::target_file_size_base)
+        .def_readwrite("num_levels", &rocksdb::ColumnFamilyOptions::num_levels)
         .def_readwrite("disable_auto_compactions", &rocksdb::ColumnFamilyOptions::disable_auto_compactions)
+        .def_property("prefix_extractor", 
+            [](const rocksdb::ColumnFamilyOptions& self) {
+                return std::const_pointer_cast<rocksdb::SliceTransform>(self.prefix_extractor);
+            },
+            [](rocksdb::ColumnFamilyOptions& self, std::shared_ptr<rocksdb::SliceTransform> prefix_extractor) {
+                self.prefix_extractor = std::move(prefix_extractor);
+            })
+        .def_readwrite("merge_operator", &rocksdb::ColumnFamilyOptions::merge_operator)
+        .def_readwrite("compaction_filter", &rocksdb::ColumnFamilyOptions::compaction_filter_factory)
+        .def_readwrite("memtable_prefix_bloom_size_ratio", &rocksdb::ColumnFamilyOptions::memtable_prefix_bloom_size_ratio)
+        .def_readwrite("memtable_whole_key_filtering", &rocksdb::ColumnFamilyOptions::memtable_whole_key_filtering)
+        .def_readwrite("optimize_filters_for_hits", &rocksdb::ColumnFamilyOptions::optimize_filters_for_hits)
         .def("to_dict", [](const rocksdb::ColumnFamilyOptions &instance) {
             return py::dict(
                 "blob_compression_type"_a = get_compression_name(instance.blob_compression_type),
@@ -119,7 +230,21 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
                 "write_buffer_size"_a = instance.write_buffer_size,
                 "level0_file_num_compaction_trigger"_a = instance.level0_file_num_compaction_trigger,
                 "max_bytes_for_level_base"_a = instance.max_bytes_for_level_base,
-                "disable_auto_compactions"_a = instance.disable_auto_compactions); 
+                "level0_slowdown_writes_trigger"_a = instance.level0_slowdown_writes_trigger,
+                "level0_stop_writes_trigger"_a = instance.level0_stop_writes_trigger,
+                "soft_pending_compaction_bytes_limit"_a = instance.soft_pending_compaction_bytes_limit,
+                "hard_pending_compaction_bytes_limit"_a = instance.hard_pending_compaction_bytes_limit,
+                "max_compaction_bytes"_a = instance.max_compaction_bytes,
+                "max_write_buffer_number"_a = instance.max_write_buffer_number,
+                "target_file_size_base"_a = instance.target_file_size_base,
+                "num_levels"_a = instance.num_levels,
+                "disable_auto_compactions"_a = instance.disable_auto_compactions,
+                "prefix_extractor"_a = instance.prefix_extractor ? py::object(py::str(instance.prefix_extractor->Name())) : py::none(),
+                "merge_operator"_a = instance.merge_operator ? py::object(py::str(instance.merge_operator->Name())) : py::none(),
+                "compaction_filter"_a = instance.compaction_filter_factory ? py::object(py::str(instance.compaction_filter_factory->Name())) : py::none(),
+                "memtable_prefix_bloom_size_ratio"_a = instance.memtable_prefix_bloom_size_ratio,
+                "memtable_whole_key_filtering"_a = instance.memtable_whole_key_filtering,
+                "optimize_filters_for_hits"_a = instance.optimize_filters_for_hits); 
         });
 
     py::enum_<rocksdb::BottommostLevelCompaction>(m, "BottommostLevelCompaction")
@@ -161,7 +286,115 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
                 "blob_garbage_collection_age_cutoff"_a = instance.blob_garbage_collection_age_cutoff);
         });
 
-/** UNFINISHED
+    py::class_<rocksdb::BackupEngineOptions>(m, "BackupEngineOptions")
+        .def(py::init<const std::string&>(), "backup_dir"_a)
+        .def_readwrite("backup_dir", &rocksdb::BackupEngineOptions::backup_dir)
+        .def_readwrite("share_table_files", &rocksdb::BackupEngineOptions::share_table_files)
+        .def_readwrite("sync", &rocksdb::BackupEngineOptions::sync)
+        .def_readwrite("destroy_old_data", &rocksdb::BackupEngineOptions::destroy_old_data)
+        .def_readwrite("backup_log_files", &rocksdb::BackupEngineOptions::backup_log_files)
+        .def_readwrite("backup_rate_limit", &rocksdb::BackupEngineOptions::backup_rate_limit)
+        .def_readwrite("restore_rate_limit", &rocksdb::BackupEngineOptions::restore_rate_limit)
+        .def_readwrite("share_files_with_checksum", &rocksdb::BackupEngineOptions::share_files_with_checksum)
+        .def_readwrite("max_background_operations", &rocksdb::BackupEngineOptions::max_background_operations)
+        .def_readwrite("callback_trigger_interval_size", &rocksdb::BackupEngineOptions::callback_trigger_interval_size)
+        .def_readwrite("max_valid_backups_to_open", &rocksdb::BackupEngineOptions::max_valid_backups_to_open)
+        .def("to_dict", [](const rocksdb::BackupEngineOptions &instance) {
+            return py::dict(
+                "backup_dir"_a = instance.backup_dir,
+                "share_table_files"_a = instance.share_table_files,
+                "sync"_a = instance.sync,
+                "destroy_old_data"_a = instance.destroy_old_data,
+                "backup_log_files"_a = instance.backup_log_files,
+                "backup_rate_limit"_a = instance.backup_rate_limit,
+                "restore_rate_limit"_a = instance.restore_rate_limit,
+                "share_files_with_checksum"_a = instance.share_files_with_checksum,
+                "max_background_operations"_a = instance.max_background_operations,
+                "callback_trigger_interval_size"_a = instance.callback_trigger_interval_size,
+                "max_valid_backups_to_open"_a = instance.max_valid_backups_to_open);
+        });
+
+    py::class_<rocksdb::Cache, std::shared_ptr<rocksdb::Cache>>(m, "Cache")
+        .def_static("lru", [](size_t capacity, int num_shard_bits, bool strict_capacity_limit, double high_pri_pool_ratio) {
+            return rocksdb::NewLRUCache(capacity, num_shard_bits, strict_capacity_limit, high_pri_pool_ratio);
+        }, "capacity"_a, "num_shard_bits"_a = -1, "strict_capacity_limit"_a = false, "high_pri_pool_ratio"_a = 0.5)
+        .def_static("hyper_clock", [](size_t capacity, size_t estimated_entry_charge, int num_shard_bits, bool strict_capacity_limit) {
+            /** estimated_entry_charge = 0 selects the self-sizing variant */
+            return rocksdb::HyperClockCacheOptions(capacity, estimated_entry_charge, num_shard_bits, strict_capacity_limit).MakeSharedCache();
+        }, "capacity"_a, "estimated_entry_charge"_a = 0, "num_shard_bits"_a = -1, "strict_capacity_limit"_a = false)
+        .def_property("capacity", &rocksdb::Cache::GetCapacity, &rocksdb::Cache::SetCapacity)
+        .def_property("strict_capacity_limit", &rocksdb::Cache::HasStrictCapacityLimit, &rocksdb::Cache::SetStrictCapacityLimit)
+        .def_property_readonly("usage", [](const rocksdb::Cache& self) {
+            return self.GetUsage();
+        })
+        .def_property_readonly("pinned_usage", &rocksdb::Cache::GetPinnedUsage)
+        .def("to_dict", [](const rocksdb::Cache &instance) {
+            return py::dict(
+                "name"_a = instance.Name(),
+                "capacity"_a = instance.GetCapacity(),
+                "strict_capacity_limit"_a = instance.HasStrictCapacityLimit(),
+                "usage"_a = instance.GetUsage(),
+                "pinned_usage"_a = instance.GetPinnedUsage());
+        });
+
+    py::enum_<rocksdb::StatsLevel>(m, "StatsLevel")
+        .value("kDisableAll", rocksdb::StatsLevel::kDisableAll)
+        .value("kExceptTickers", rocksdb::StatsLevel::kExceptTickers)
+        .value("kExceptHistogramOrTimers", rocksdb::StatsLevel::kExceptHistogramOrTimers)
+        .value("kExceptTimers", rocksdb::StatsLevel::kExceptTimers)
+        .value("kExceptDetailedTimers", rocksdb::StatsLevel::kExceptDetailedTimers)
+        .value("kExceptTimeForMutex", rocksdb::StatsLevel::kExceptTimeForMutex)
+        .value("kAll", rocksdb::StatsLevel::kAll)
+        .export_values();
+
+    // Shared by every DB whose DBOptions.statistics points at it
+    py::class_<rocksdb::Statistics, std::shared_ptr<rocksdb::Statistics>>(m, "Statistics")
+        .def(py::init(&rocksdb::CreateDBStatistics))
+        .def_property("stats_level", &rocksdb::Statistics::get_stats_level, &rocksdb::Statistics::set_stats_level)
+        .def("ticker", [](const rocksdb::Statistics& self, const std::string& name) {
+            for (const auto& [ticker, ticker_name] : rocksdb::TickersNameMap)
+                if (ticker_name == name) return self.getTickerCount(ticker);
+            throw std::invalid_argument("Unknown ticker: " + name);
+        }, "name"_a)
+        .def("reset", [](rocksdb::Statistics& self) {
+            auto status = self.Reset();
+            if (!status.ok())
+                throw std::runtime_error("Statistics reset failed: " + status.ToString());
+        })
+        .def("__str__", &rocksdb::Statistics::ToString)
+        .def("to_dict", &statistics_to_dict);
+
+    py::enum_<rocksdb::PerfLevel>(m, "PerfLevel")
+        .value("kDisable", rocksdb::PerfLevel::kDisable)
+        .value("kEnableCount", rocksdb::PerfLevel::kEnableCount)
+        .value("kEnableTimeExceptForMutex", rocksdb::PerfLevel::kEnableTimeExceptForMutex)
+        .value("kEnableTimeAndCPUTimeExceptForMutex", rocksdb::PerfLevel::kEnableTimeAndCPUTimeExceptForMutex)
+        .value("kEnableTime", rocksdb::PerfLevel::kEnableTime)
+        .export_values();
+
+    // Perf and IO stats contexts are thread-local: these act on the calling thread only
+    m.def("set_perf_level", &rocksdb::SetPerfLevel, "level"_a);
+    m.def("get_perf_level", &rocksdb::GetPerfLevel);
+    m.def("reset_perf_context", []() {
+        rocksdb::get_perf_context()->Reset();
+        rocksdb::get_iostats_context()->Reset();
+    });
+    m.def("perf_context", &perf_context_to_dict);
+    m.def("iostats_context", &iostats_context_to_dict);
+
+    py::enum_<rocksdb::BlockBasedTableOptions::DataBlockIndexType>(m, "DataBlockIndexType")
+        .value("kDataBlockBinarySearch", rocksdb::BlockBasedTableOptions::kDataBlockBinarySearch)
+        .value("kDataBlockBinaryAndHash", rocksdb::BlockBasedTableOptions::kDataBlockBinaryAndHash)
+        .export_values();
+
+    py::enum_<rocksdb::ChecksumType>(m, "ChecksumType")
+        .value("kNoChecksum", rocksdb::ChecksumType::kNoChecksum)
+        .value("kCRC32c", rocksdb::ChecksumType::kCRC32c)
+        .value("kxxHash", rocksdb::ChecksumType::kxxHash)
+        .value("kxxHash64", rocksdb::ChecksumType::kxxHash64)
+        .value("kXXH3", rocksdb::ChecksumType::kXXH3)
+        .export_values();
+
     py::class_<rocksdb::BlockBasedTableOptions>(m, "BlockBasedTableOptions")
         .def(py::init())
          // .def_readwrite("flush_block_policy_factory", &rocksdb::BlockBasedTableOptions::flush_block_policy_factory)
@@ -169,25 +402,31 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
         .def_readwrite("cache_index_and_filter_blocks_with_high_priority", &rocksdb::BlockBasedTableOptions::cache_index_and_filter_blocks_with_high_priority)
         .def_readwrite("pin_l0_filter_and_index_blocks_in_cache", &rocksdb::BlockBasedTableOptions::pin_l0_filter_and_index_blocks_in_cache)
         .def_readwrite("pin_top_level_index_and_filter", &rocksdb::BlockBasedTableOptions::pin_top_level_index_and_filter)
-        .def_readwrite("metadata_cache_options", &rocksdb::BlockBasedTableOptions::metadata_cache_options)
+        // .def_readwrite("metadata_cache_options", &rocksdb::BlockBasedTableOptions::metadata_cache_options)
          // .def_readwrite("index_type", &rocksdb::BlockBasedTableOptions::index_type)
         .def_readwrite("data_block_index_type", &rocksdb::BlockBasedTableOptions::data_block_index_type)
         .def_readwrite("data_block_hash_table_util_ratio", &rocksdb::BlockBasedTableOptions::data_block_hash_table_util_ratio)
         .def_readwrite("checksum", &rocksdb::BlockBasedTableOptions::checksum)
         .def_readwrite("no_block_cache", &rocksdb::BlockBasedTableOptions::no_block_cache)
-         // .def_readwrite("block_cache", &rocksdb::BlockBasedTableOptions::block_cache)
-        .def_readwrite("persistent_cache", &rocksdb::BlockBasedTableOptions::persistent_cache)
+        .def_readwrite("block_cache", &rocksdb::BlockBasedTableOptions::block_cache)
+        // .def_readwrite("persistent_cache", &rocksdb::BlockBasedTableOptions::persistent_cache)
         .def_readwrite("block_size", &rocksdb::BlockBasedTableOptions::block_size)
         .def_readwrite("block_size_deviation", &rocksdb::BlockBasedTableOptions::block_size_deviation)
         .def_readwrite("block_restart_interval", &rocksdb::BlockBasedTableOptions::block_restart_interval)
         .def_readwrite("index_block_restart_interval", &rocksdb::BlockBasedTableOptions::index_block_restart_interval)
         .def_readwrite("metadata_block_size", &rocksdb::BlockBasedTableOptions::metadata_block_size)
-        .def_readwrite("cache_usage_options", &rocksdb::BlockBasedTableOptions::cache_usage_options)
+        // .def_readwrite("cache_usage_options", &rocksdb::BlockBasedTableOptions::cache_usage_options)
         .def_readwrite("partition_filters", &rocksdb::BlockBasedTableOptions::partition_filters)
         .def_readwrite("decouple_partitioned_filters", &rocksdb::BlockBasedTableOptions::decouple_partitioned_filters)
         .def_readwrite("optimize_filters_for_memory", &rocksdb::BlockBasedTableOptions::optimize_filters_for_memory)
         .def_readwrite("use_delta_encoding", &rocksdb::BlockBasedTableOptions::use_delta_encoding)
-        // .def_readwrite("filter_policy", &rocksdb::BlockBasedTableOptions::filter_policy)
+        .def_property("filter_policy", 
+            [](const rocksdb::BlockBasedTableOptions& self) {
+                return std::const_pointer_cast<rocksdb::FilterPolicy>(self.filter_policy);
+            },
+            [](rocksdb::BlockBasedTableOptions& self, std::shared_ptr<rocksdb::FilterPolicy> filter_policy) {
+                self.filter_policy = std::move(filter_policy);
+            })
         .def_readwrite("whole_key_filtering", &rocksdb::BlockBasedTableOptions::whole_key_filtering)
         .def_readwrite("detect_filter_construct_corruption", &rocksdb::BlockBasedTableOptions::detect_filter_construct_corruption)
         .def_readwrite("verify_compression", &rocksdb::BlockBasedTableOptions::verify_compression)
@@ -199,8 +438,39 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
         .def_readwrite("max_auto_readahead_size", &rocksdb::BlockBasedTableOptions::max_auto_readahead_size)
         // .def_readwrite("prepopulate_block_cache", &rocksdb::BlockBasedTableOptions::prepopulate_block_cache)
         .def_readwrite("initial_auto_readahead_size", &rocksdb::BlockBasedTableOptions::initial_auto_readahead_size)
-        .def_readwrite("num_file_reads_for_auto_readahead", &rocksdb::BlockBasedTableOptions::num_file_reads_for_auto_readahead);
-*/
+        .def_readwrite("num_file_reads_for_auto_readahead", &rocksdb::BlockBasedTableOptions::num_file_reads_for_auto_readahead)
+        .def("to_dict", [](const rocksdb::BlockBasedTableOptions &instance) {
+            return py::dict(
+                "cache_index_and_filter_blocks"_a = instance.cache_index_and_filter_blocks,
+                "cache_index_and_filter_blocks_with_high_priority"_a = instance.cache_index_and_filter_blocks_with_high_priority,
+                "pin_l0_filter_and_index_blocks_in_cache"_a = instance.pin_l0_filter_and_index_blocks_in_cache,
+                "pin_top_level_index_and_filter"_a = instance.pin_top_level_index_and_filter,
+                "data_block_index_type"_a = instance.data_block_index_type,
+                "data_block_hash_table_util_ratio"_a = instance.data_block_hash_table_util_ratio,
+                "checksum"_a = instance.checksum,
+                "no_block_cache"_a = instance.no_block_cache,
+                "block_cache_capacity"_a = instance.block_cache ? py::object(py::int_(instance.block_cache->GetCapacity())) : py::none(),
+                "block_size"_a = instance.block_size,
+                "block_size_deviation"_a = instance.block_size_deviation,
+                "block_restart_interval"_a = instance.block_restart_interval,
+                "index_block_restart_interval"_a = instance.index_block_restart_interval,
+                "metadata_block_size"_a = instance.metadata_block_size,
+                "partition_filters"_a = instance.partition_filters,
+                "decouple_partitioned_filters"_a = instance.decouple_partitioned_filters,
+                "optimize_filters_for_memory"_a = instance.optimize_filters_for_memory,
+                "use_delta_encoding"_a = instance.use_delta_encoding,
+                "filter_policy"_a = instance.filter_policy ? py::object(py::str(instance.filter_policy->Name())) : py::none(),
+                "whole_key_filtering"_a = instance.whole_key_filtering,
+                "detect_filter_construct_corruption"_a = instance.detect_filter_construct_corruption,
+                "verify_compression"_a = instance.verify_compression,
+                "read_amp_bytes_per_bit"_a = instance.read_amp_bytes_per_bit,
+                "format_version"_a = instance.format_version,
+                "enable_index_compression"_a = instance.enable_index_compression,
+                "block_align"_a = instance.block_align,
+                "max_auto_readahead_size"_a = instance.max_auto_readahead_size,
+                "initial_auto_readahead_size"_a = instance.initial_auto_readahead_size,
+                "num_file_reads_for_auto_readahead"_a = instance.num_file_reads_for_auto_readahead);
+        });
 
     py::enum_<rocksdb::EncodingType>(m, "EncodingType")
         .value("kPlain", rocksdb::EncodingType::kPlain)
@@ -229,6 +499,17 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
                 "bloom_bits_per_key"_a = instance.bloom_bits_per_key);
         });
 
+    // The environment RocksDB does file IO and reads the clock through, for
+    // DBOptions.env and time-based filters
+    py::class_<rocksdb::Env, std::shared_ptr<rocksdb::Env>>(m, "Env")
+        .def_static("default", []() { return EnvRegistry::get(rocksdb::Env::Default()); })
+        .def_property_readonly("name", [](const rocksdb::Env& self) { return std::string(self.Name()); });
+
+    py::class_<MockTimeEnv, rocksdb::Env, std::shared_ptr<MockTimeEnv>>(m, "MockTimeEnv")
+        .def(py::init())
+        .def("advance", &MockTimeEnv::advance, "seconds"_a)
+        .def_property_readonly("offset", &MockTimeEnv::offset);
+
     // Register DBOptions class
     py::class_<rocksdb::DBOptions>(m, "cDBOptions")
         .def(py::init())
@@ -236,6 +517,13 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
             self.IncreaseParallelism(total_threads);
             return py::none();
         })
+        // The DB half of Options::PrepareForBulkLoad
+        .def("prepare_for_bulk_load", [](rocksdb::DBOptions& self) {
+            rocksdb::Options options(self, rocksdb::ColumnFamilyOptions());
+            options.PrepareForBulkLoad();
+            self = rocksdb::DBOptions(options);
+            return py::none();
+        })
         .def_readwrite("create_if_missing", &rocksdb::DBOptions::create_if_missing)
         .def_readwrite("create_missing_column_families", &rocksdb::DBOptions::create_missing_column_families)
         .def_readwrite("error_if_exists", &rocksdb::DBOptions::error_if_exists)
@@ -247,6 +535,15 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
         .def_readwrite("max_file_opening_threads", &rocksdb::DBOptions::max_file_opening_threads)
         .def_readwrite("max_total_wal_size", &rocksdb::DBOptions::max_total_wal_size)
         .def_readwrite("use_fsync", &rocksdb::DBOptions::use_fsync)
+        .def_readwrite("row_cache", &rocksdb::DBOptions::row_cache)
+        .def_readwrite("statistics", &rocksdb::DBOptions::statistics)
+        // None selects Env.default()
+        .def_property("env", 
+            [](const rocksdb::DBOptions& self) { return EnvRegistry::get(self.env); },
+            py::cpp_function([](rocksdb::DBOptions& self, std::shared_ptr<rocksdb::Env> env) {
+                EnvRegistry::add(env);
+                self.env = env ? env.get() : rocksdb::Env::Default();
+            }, py::keep_alive<1, 2>()))
         .def_readwrite("db_log_dir", &rocksdb::DBOptions::db_log_dir)
         .def_readwrite("wal_dir", &rocksdb::DBOptions::wal_dir)
         .def_readwrite("delete_obsolete_files_period_micros", &rocksdb::DBOptions::delete_obsolete_files_period_micros)
@@ -329,6 +626,8 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
         .def("to_dict", [](const rocksdb::DBOptions &instance) {
             return py::dict(
                 "create_if_missing"_a = instance.create_if_missing,
+                "row_cache_capacity"_a = instance.row_cache ? py::object(py::int_(instance.row_cache->GetCapacity())) : py::none(),
+                "stats_level"_a = instance.statistics ? py::object(py::cast(instance.statistics->get_stats_level())) : py::none(),
                 "create_missing_column_families"_a = instance.create_missing_column_families,
                 "error_if_exists"_a = instance.error_if_exists, 
                 "paranoid_checks"_a = instance.paranoid_checks,
@@ -426,31 +725,231 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
         .def(py::init());
     py::class_<DbOpenRO, DbOpenBase>(m, "DbOpenRO")
         .def(py::init());
-    /* TODO: Unfinished
-    py::class_<DbOpenTTL>(m, "DbOpenTTL")
-        .def(py::init<uint64_t>());
-    py::class_<DbOpenSecondary>(m, "DbOpenSecondary")
-        .def(py::init());
-    py::class_<DBOpenOptimisticTransation>(m, "DBOpenOptimisticTransation")
+    py::class_<DbOpenTTL, DbOpenBase>(m, "DbOpenTTL")
+        .def(py::init<int32_t, bool, const std::unordered_map<std::string, int32_t>&>(), 
+             "ttl"_a = 0, "read_only"_a = false, "ttls"_a = std::unordered_map<std::string, int32_t>())
+        .def_readwrite("ttl", &DbOpenTTL::ttl)
+        .def_readwrite("read_only", &DbOpenTTL::read_only)
+        .def_readwrite("ttls", &DbOpenTTL::ttls);
+    py::class_<DbOpenSecondary, DbOpenBase>(m, "DbOpenSecondary")
+        .def(py::init<const std::string&, uint32_t>(), "secondary_path"_a, "catch_up_interval_ms"_a = 0)
+        .def_readwrite("secondary_path", &DbOpenSecondary::secondary_path)
+        .def_readwrite("catch_up_interval_ms", &DbOpenSecondary::catch_up_interval_ms);
+    py::class_<DbOpenOptimisticTransaction, DbOpenBase>(m, "DbOpenOptimisticTransaction")
         .def(py::init());
-    py::class_<DBOpenTransation>(m, "DBOpenTransation")
-        .def(py::init());
-    */
+    py::class_<DbOpenTransaction, DbOpenBase>(m, "DbOpenTransaction")
+        .def(py::init<int64_t, int64_t, size_t, int64_t>(), "transaction_lock_timeout"_a = 1000, 
+             "default_lock_timeout"_a = 1000, "num_stripes"_a = 16, "max_num_locks"_a = -1)
+        .def_readwrite("transaction_lock_timeout", &DbOpenTransaction::transaction_lock_timeout)
+        .def_readwrite("default_lock_timeout", &DbOpenTransaction::default_lock_timeout)
+        .def_readwrite("num_stripes", &DbOpenTransaction::num_stripes)
+        .def_readwrite("max_num_locks", &DbOpenTransaction::max_num_locks);
+
+    py::enum_<rocksdb::ReadTier>(m, "ReadTier")
+        .value("kReadAllTier", rocksdb::ReadTier::kReadAllTier)
+        .value("kBlockCacheTier", rocksdb::ReadTier::kBlockCacheTier)
+        .value("kPersistedTier", rocksdb::ReadTier::kPersistedTier)
+        .value("kMemtableTier", rocksdb::ReadTier::kMemtableTier)
+        .export_values();
+
+    py::enum_<rocksdb::Env::IOPriority>(m, "IOPriority")
+        .value("IO_LOW", rocksdb::Env::IOPriority::IO_LOW)
+        .value("IO_MID", rocksdb::Env::IOPriority::IO_MID)
+        .value("IO_HIGH", rocksdb::Env::IOPriority::IO_HIGH)
+        .value("IO_USER", rocksdb::Env::IOPriority::IO_USER)
+        .value("IO_TOTAL", rocksdb::Env::IOPriority::IO_TOTAL)
+        .export_values();
+
+    // Passed by pointer to the DB calls, so one instance can be reused for many
+    // calls. Iterator bounds are given separately; a snapshot passed to a call
+    // takes precedence over the one set here.
+    py::class_<ReadOptionsWrapper>(m, "ReadOptions")
+        .def(py::init())
+        .def_readwrite("verify_checksums", &rocksdb::ReadOptions::verify_checksums)
+        .def_readwrite("fill_cache", &rocksdb::ReadOptions::fill_cache)
+        .def_readwrite("read_tier", &rocksdb::ReadOptions::read_tier)
+        .def_readwrite("async_io", &rocksdb::ReadOptions::async_io)
+        .def_readwrite("optimize_multiget_for_io", &rocksdb::ReadOptions::optimize_multiget_for_io)
+        .def_readwrite("rate_limiter_priority", &rocksdb::ReadOptions::rate_limiter_priority)
+        .def_readwrite("value_size_soft_limit", &rocksdb::ReadOptions::value_size_soft_limit)
+        .def_readwrite("ignore_range_deletions", &rocksdb::ReadOptions::ignore_range_deletions)
+        .def_readwrite("adaptive_readahead", &rocksdb::ReadOptions::adaptive_readahead)
+        // Absolute deadline in microseconds since the epoch, 0 for none
+        .def_property("deadline",
+            [](const ReadOptionsWrapper& self) { return static_cast<uint64_t>(self.deadline.count()); },
+            [](ReadOptionsWrapper& self, uint64_t us) { self.deadline = std::chrono::microseconds(us); })
+        // Per-file-read timeout in microseconds, 0 for none
+        .def_property("io_timeout",
+            [](const ReadOptionsWrapper& self) { return static_cast<uint64_t>(self.io_timeout.count()); },
+            [](ReadOptionsWrapper& self, uint64_t us) { self.io_timeout = std::chrono::microseconds(us); })
+        // A Snapshot or cSnapshot, or None. Held by the options; reads through
+        // them fail once it is released.
+        .def_property("snapshot",
+            [](const ReadOptionsWrapper& self) { return self.snapshot_object; },
+            [](ReadOptionsWrapper& self, py::object snapshot) {
+                py::object handle = py::hasattr(snapshot, "_snapshot") ? snapshot.attr("_snapshot") : snapshot;
+                self.snapshot_handle = handle.is_none() ? nullptr : handle.cast<SnapshotWrapper*>();
+                self.snapshot_object = snapshot;
+            })
+        .def("__copy__", [](const ReadOptionsWrapper& self) {
+            return ReadOptionsWrapper(self);
+        })
+        .def("to_dict", [](const ReadOptionsWrapper &instance) {
+            return py::dict(
+                "verify_checksums"_a = instance.verify_checksums,
+                "fill_cache"_a = instance.fill_cache,
+                "read_tier"_a = instance.read_tier,
+                "async_io"_a = instance.async_io,
+                "optimize_multiget_for_io"_a = instance.optimize_multiget_for_io,
+                "rate_limiter_priority"_a = instance.rate_limiter_priority,
+                "value_size_soft_limit"_a = instance.value_size_soft_limit,
+                "ignore_range_deletions"_a = instance.ignore_range_deletions,
+                "adaptive_readahead"_a = instance.adaptive_readahead,
+                "deadline"_a = static_cast<uint64_t>(instance.deadline.count()),
+                "io_timeout"_a = static_cast<uint64_t>(instance.io_timeout.count()));
+        });
+
+    py::class_<rocksdb::WriteOptions>(m, "WriteOptions")
+        .def(py::init())
+        .def_readwrite("sync", &rocksdb::WriteOptions::sync)
+        .def_readwrite("disableWAL", &rocksdb::WriteOptions::disableWAL)
+        .def_readwrite("ignore_missing_column_families", &rocksdb::WriteOptions::ignore_missing_column_families)
+        .def_readwrite("no_slowdown", &rocksdb::WriteOptions::no_slowdown)
+        .def_readwrite("low_pri", &rocksdb::WriteOptions::low_pri)
+        .def_readwrite("memtable_insert_hint_per_batch", &rocksdb::WriteOptions::memtable_insert_hint_per_batch)
+        .def_readwrite("rate_limiter_priority", &rocksdb::WriteOptions::rate_limiter_priority)
+        .def("__copy__", [](const rocksdb::WriteOptions& self) {
+            return rocksdb::WriteOptions(self);
+        })
+        .def("to_dict", [](const rocksdb::WriteOptions &instance) {
+            return py::dict(
+                "sync"_a = instance.sync,
+                "disableWAL"_a = instance.disableWAL,
+                "ignore_missing_column_families"_a = instance.ignore_missing_column_families,
+                "no_slowdown"_a = instance.no_slowdown,
+                "low_pri"_a = instance.low_pri,
+                "memtable_insert_hint_per_batch"_a = instance.memtable_insert_hint_per_batch,
+                "rate_limiter_priority"_a = instance.rate_limiter_priority);
+        });
+
+    py::class_<IteratorOptions>(m, "IteratorOptions")
+        .def(py::init())
+        .def_property("lower_bound", 
+            [](const IteratorOptions& self) -> std::optional<py::bytes> {
+                if (self.lower_bound) return py::bytes(*self.lower_bound);
+                return std::nullopt;
+            },
+            [](IteratorOptions& self, const std::optional<py::bytes>& key) {
+                self.lower_bound = key ? std::optional<std::string>(std::string(*key)) : std::nullopt;
+            })
+        .def_property("upper_bound", 
+            [](const IteratorOptions& self) -> std::optional<py::bytes> {
+                if (self.upper_bound) return py::bytes(*self.upper_bound);
+                return std::nullopt;
+            },
+            [](IteratorOptions& self, const std::optional<py::bytes>& key) {
+                self.upper_bound = key ? std::optional<std::string>(std::string(*key)) : std::nullopt;
+            })
+        .def_readwrite("prefix_same_as_start", &IteratorOptions::prefix_same_as_start)
+        .def_readwrite("total_order_seek", &IteratorOptions::total_order_seek)
+        .def_readwrite("readahead_size", &IteratorOptions::readahead_size)
+        .def_readwrite("fill_cache", &IteratorOptions::fill_cache)
+        .def_readwrite("auto_readahead_size", &IteratorOptions::auto_readahead_size)
+        .def_readwrite("pin_data", &IteratorOptions::pin_data)
+        .def("__copy__", [](const IteratorOptions& self) {
+            return IteratorOptions(self);
+        })
+        .def("to_dict", [](const IteratorOptions &instance) {
+            return py::dict(
+                "lower_bound"_a = instance.lower_bound ? py::object(py::bytes(*instance.lower_bound)) : py::none(),
+                "upper_bound"_a = instance.upper_bound ? py::object(py::bytes(*instance.upper_bound)) : py::none(),
+                "prefix_same_as_start"_a = instance.prefix_same_as_start,
+                "total_order_seek"_a = instance.total_order_seek,
+                "readahead_size"_a = instance.readahead_size,
+                "fill_cache"_a = instance.fill_cache,
+                "auto_readahead_size"_a = instance.auto_readahead_size,
+                "pin_data"_a = instance.pin_data);
+        });
+
+    // Read-only bytes exposed through the buffer protocol, e.g. memoryview(value)
+    py::class_<PinnedValue>(m, "PinnedValue", py::buffer_protocol())
+        .def_buffer([](PinnedValue& self) -> py::buffer_info {
+            return py::buffer_info(const_cast<char*>(self.data()), 1, py::format_descriptor<uint8_t>::format(), 
+                                   1, {static_cast<py::ssize_t>(self.size())}, {1}, true);
+        })
+        .def("__len__", &PinnedValue::size)
+        .def("__bytes__", [](const PinnedValue& self) {
+            return py::bytes(self.data(), self.size());
+        });
+
+    // Columns of DbIterator.next_columnar(), shared with numpy/pyarrow without copying
+    py::class_<ColumnBuffer>(m, "ColumnBuffer", py::buffer_protocol())
+        .def_buffer([](ColumnBuffer& self) -> py::buffer_info {
+            if (self.itemsize == sizeof(int64_t))
+                return py::buffer_info(const_cast<void*>(self.data), sizeof(int64_t), py::format_descriptor<int64_t>::format(), 
+                                       1, {static_cast<py::ssize_t>(self.count)}, {static_cast<py::ssize_t>(sizeof(int64_t))}, true);
+            return py::buffer_info(const_cast<void*>(self.data), 1, py::format_descriptor<uint8_t>::format(), 
+                                   1, {static_cast<py::ssize_t>(self.count)}, {1}, true);
+        })
+        .def("__len__", [](const ColumnBuffer& self) { return self.count; });
+
+    py::class_<ColumnarBatch, std::shared_ptr<ColumnarBatch>>(m, "cColumnarBatch")
+        .def("__len__", &ColumnarBatch::size)
+        .def_readonly("has_int_keys", &ColumnarBatch::has_int_keys)
+        .def_property_readonly("key_data", [](std::shared_ptr<ColumnarBatch> self) { return ColumnBuffer(self, self->key_data); })
+        .def_property_readonly("key_offsets", [](std::shared_ptr<ColumnarBatch> self) { return ColumnBuffer(self, self->key_offsets); })
+        .def_property_readonly("value_data", [](std::shared_ptr<ColumnarBatch> self) { return ColumnBuffer(self, self->value_data); })
+        .def_property_readonly("value_offsets", [](std::shared_ptr<ColumnarBatch> self) { return ColumnBuffer(self, self->value_offsets); })
+        .def_property_readonly("int_keys", [](std::shared_ptr<ColumnarBatch> self) { return ColumnBuffer(self, self->int_keys); });
 
     // Register DB class
     py::class_<DBWrapper>(m, "cDB")
         .def_static("open", &DBWrapper::open)
         .def("get_column_family", &DBWrapper::get_column_family)
-        .def("put", &DBWrapper::put)
-        .def("get", &DBWrapper::get)
-        .def("delete", &DBWrapper::delete_key)
-        .def("write", &DBWrapper::write)
-        .def("compact_range", &DBWrapper::compact_range)
-        .def("create_iterator", &DBWrapper::create_iterator, py::keep_alive<0, 1>())
-        .def("create_snapshot", &DBWrapper::create_snapshot)
+        .def("put", &DBWrapper::put, "cfh"_a, "key"_a, "value"_a, "write_options"_a = py::none())
+        .def("get", &DBWrapper::get, "cfh"_a, "key"_a, "snapshot"_a = py::none(), "read_options"_a = py::none())
+        .def("get_pinned", &DBWrapper::get_pinned, "cfh"_a, "key"_a, "snapshot"_a = py::none(), "read_options"_a = py::none())
+        .def("multi_get", &DBWrapper::multi_get, "cfh"_a, "keys"_a, "snapshot"_a = py::none(), "read_options"_a = py::none())
+        .def("multi_get_cf", &DBWrapper::multi_get_cf, "cfhs"_a, "keys"_a, "snapshot"_a = py::none(), "read_options"_a = py::none())
+        .def("merge", &DBWrapper::merge, "cfh"_a, "key"_a, "value"_a, "write_options"_a = py::none())
+        .def("delete", &DBWrapper::delete_key, "cfh"_a, "key"_a, "write_options"_a = py::none())
+        .def("delete_range", &DBWrapper::delete_range, "cfh"_a, "begin"_a, "end"_a, "write_options"_a = py::none())
+        .def("delete_files_in_range", &DBWrapper::delete_files_in_range, "cfh"_a, "begin"_a, "end"_a, "include_end"_a = false)
+        .def("write", &DBWrapper::write, "batch"_a, "write_options"_a = py::none())
+        .def("compact_range", &DBWrapper::compact_range, "compact_range_options"_a, "from_key"_a, "to_key"_a, "cfh"_a = py::none())
+        .def("flush", &DBWrapper::flush, "cfhs"_a = py::none(), "wait"_a = true, "allow_write_stall"_a = false)
+        .def("flush_wal", &DBWrapper::flush_wal, "sync"_a = false)
+        .def("wait_for_compact", &DBWrapper::wait_for_compact, "flush"_a = false, "abort_on_pause"_a = false, "timeout_ms"_a = 0)
+        .def("pause_background_work", &DBWrapper::pause_background_work)
+        .def("continue_background_work", &DBWrapper::continue_background_work)
+        .def("enable_auto_compaction", &DBWrapper::enable_auto_compaction, "cfhs"_a = py::none())
+        .def("ingest_external_file", &DBWrapper::ingest_external_file, "paths"_a, "cfh"_a, "move_files"_a = false, 
+             "snapshot_consistency"_a = true, "allow_global_seqno"_a = true, "ingest_behind"_a = false)
+        .def("create_iterator", &DBWrapper::create_iterator, "cfh"_a, "options"_a = IteratorOptions(), "snapshot"_a = py::none(), 
+             "read_options"_a = py::none(), py::keep_alive<0, 1>())
+        .def("set_ttl", &DBWrapper::set_ttl, "cfh"_a, "ttl"_a)
+        .def("try_catch_up_with_primary", &DBWrapper::try_catch_up_with_primary)
+        .def("start_catch_up", &DBWrapper::start_catch_up, "interval_ms"_a)
+        .def("stop_catch_up", &DBWrapper::stop_catch_up)
+        .def("create_checkpoint", &DBWrapper::create_checkpoint, "checkpoint_dir"_a, "log_size_for_flush"_a = 0)
+        .def("create_snapshot", &DBWrapper::create_snapshot, py::keep_alive<0, 1>())
         .def("release_snapshot", &DBWrapper::release_snapshot)
+        .def("begin_transaction", &DBWrapper::begin_transaction, "write_options"_a = py::none(), "set_snapshot"_a = false, 
+             "lock_timeout_ms"_a = -1, py::keep_alive<0, 1>())
         .def("close", &DBWrapper::close)
         .def("list_column_families", &DBWrapper::list_column_families)
+        .def("create_column_family", &DBWrapper::create_column_family, "name"_a, "options"_a)
+        .def("create_column_families", &DBWrapper::create_column_families, "column_families"_a)
+        .def("drop_column_family", &DBWrapper::drop_column_family, "cfh"_a)
+        .def("set_options", &DBWrapper::set_options, "cfh"_a, "options"_a)
+        .def("set_db_options", &DBWrapper::set_db_options, "options"_a)
+        .def("get_options", &DBWrapper::get_options, "cfh"_a)
+        .def("get_db_options", &DBWrapper::get_db_options)
+        .def("get_option_strings", &DBWrapper::get_option_strings, "cfh"_a)
+        .def("get_db_option_strings", &DBWrapper::get_db_option_strings)
+        .def("get_property", &DBWrapper::get_property, "name"_a, "cfh"_a = py::none())
+        .def("get_int_property", &DBWrapper::get_int_property, "name"_a, "cfh"_a = py::none())
+        .def("get_map_property", &DBWrapper::get_map_property, "name"_a, "cfh"_a = py::none())
         .def_static("get_column_families", &DBWrapper::get_column_families);
 
 
@@ -464,15 +963,117 @@ PYBIND11_MODULE(_rocksdb_cpp, m) {
         .def("prev", &IteratorWrapper::prev)
         .def("key", &IteratorWrapper::key)
         .def("value", &IteratorWrapper::value)
+        .def("value_view", &IteratorWrapper::value_view)
+        .def("next_batch", &IteratorWrapper::next_batch, "n"_a, "max_bytes"_a = 0, "reverse"_a = false)
+        .def("next_columnar", &IteratorWrapper::next_columnar, "n"_a, "max_bytes"_a = 0, "reverse"_a = false, "key_width"_a = 0, 
+             "signed_keys"_a = false)
         .def("close", &IteratorWrapper::close);
 
+    // Register Snapshot class
+    py::class_<SnapshotWrapper>(m, "cSnapshot")
+        .def("release", &SnapshotWrapper::release)
+        .def_property_readonly("valid", &SnapshotWrapper::valid)
+        .def_property_readonly("sequence_number", &SnapshotWrapper::sequence_number);
+
+    py::register_exception<TransactionConflict>(m, "TransactionConflict", PyExc_RuntimeError);
+
+    // Register Transaction class
+    py::class_<TransactionWrapper>(m, "cTransaction")
+        .def("put", &TransactionWrapper::put, "cfh"_a, "key"_a, "value"_a)
+        .def("delete", &TransactionWrapper::delete_key, "cfh"_a, "key"_a)
+        .def("merge", &TransactionWrapper::merge, "cfh"_a, "key"_a, "value"_a)
+        .def("get", &TransactionWrapper::get, "cfh"_a, "key"_a, "read_options"_a = py::none())
+        .def("get_for_update", &TransactionWrapper::get_for_update, "cfh"_a, "key"_a, "exclusive"_a = true, 
+             "read_options"_a = py::none())
+        .def("set_savepoint", &TransactionWrapper::set_savepoint)
+        .def("rollback_to_savepoint", &TransactionWrapper::rollback_to_savepoint)
+        .def("pop_savepoint", &TransactionWrapper::pop_savepoint)
+        .def("set_snapshot", &TransactionWrapper::set_snapshot)
+        .def_property_readonly("has_snapshot", &TransactionWrapper::has_snapshot)
+        .def("commit", &TransactionWrapper::commit)
+        .def("rollback", &TransactionWrapper::rollback)
+        .def_property_readonly("valid", &TransactionWrapper::valid);
+
+    // Register AsyncExecutor class
+    py::class_<AsyncExecutor>(m, "cAsyncExecutor")
+        .def(py::init<DBWrapper&, size_t>(), "db"_a, "threads"_a = 4, py::keep_alive<1, 2>())
+        .def("fileno", &AsyncExecutor::fileno)
+        .def("submit_get", &AsyncExecutor::submit_get, "cfh"_a, "key"_a, "snapshot"_a = py::none(), "read_options"_a = py::none())
+        .def("submit_multi_get", &AsyncExecutor::submit_multi_get, "cfh"_a, "keys"_a, "snapshot"_a = py::none(), 
+             "read_options"_a = py::none())
+        .def("submit_put", &AsyncExecutor::submit_put, "cfh"_a, "key"_a, "value"_a, "write_options"_a = py::none())
+        .def("submit_write", &AsyncExecutor::submit_write, "batch"_a, "write_options"_a = py::none())
+        .def("submit_next_batch", &AsyncExecutor::submit_next_batch, "iterator"_a, "n"_a, "max_bytes"_a = 0, 
+             "reverse"_a = false, "reposition"_a = false)
+        .def("drain", &AsyncExecutor::drain)
+        .def("close", &AsyncExecutor::close);
+
+    // Register GroupCommitWriter class
+    py::class_<GroupCommitWriter>(m, "cGroupCommitWriter")
+        .def(py::init<DBWrapper&, const rocksdb::WriteOptions*, size_t, size_t, uint32_t>(), "db"_a, "write_options"_a = py::none(), 
+             "max_bytes"_a = 1 << 20, "max_count"_a = 1024, "max_delay_us"_a = 1000, py::keep_alive<1, 2>())
+        .def("put", &GroupCommitWriter::put, "cfh"_a, "key"_a, "value"_a, "wait"_a = true)
+        .def("merge", &GroupCommitWriter::merge, "cfh"_a, "key"_a, "value"_a, "wait"_a = true)
+        .def("delete", &GroupCommitWriter::delete_key, "cfh"_a, "key"_a, "wait"_a = true)
+        .def("flush", &GroupCommitWriter::flush)
+        .def("close", &GroupCommitWriter::close)
+        .def_property_readonly("batches_written", &GroupCommitWriter::batches_written)
+        .def_property_readonly("operations_written", &GroupCommitWriter::operations_written);
+
+    // Register ParallelScan class
+    py::class_<ParallelScan>(m, "cParallelScan")
+        .def(py::init<DBWrapper&, ColumnFamilyHandle, const std::optional<py::bytes>&, const std::optional<py::bytes>&, size_t, size_t, 
+                      SnapshotWrapper*, const ReadOptionsWrapper*, size_t, size_t, bool, size_t>(), 
+             "db"_a, "cfh"_a, "begin"_a = py::none(), "end"_a = py::none(), "partitions"_a = 16, "threads"_a = 4, "snapshot"_a = py::none(), 
+             "read_options"_a = py::none(), "batch_size"_a = 1024, "max_bytes"_a = 1 << 20, "ordered"_a = true, "max_pending"_a = 4, 
+             py::keep_alive<1, 2>())
+        .def("partitions", &ParallelScan::partitions)
+        .def("next_chunk", &ParallelScan::next_chunk)
+        .def("aggregate", &ParallelScan::aggregate)
+        .def("close", &ParallelScan::close);
+
+    // Register SstFileWriter class
+    py::class_<SstFileWriterWrapper>(m, "cSstFileWriter")
+        .def(py::init<const rocksdb::DBOptions&, const rocksdb::ColumnFamilyOptions&>(), "db_options"_a, "cf_options"_a)
+        .def("open", &SstFileWriterWrapper::open)
+        .def("put", &SstFileWriterWrapper::put)
+        .def("delete", &SstFileWriterWrapper::delete_key)
+        .def("put_many", &SstFileWriterWrapper::put_many)
+        .def("finish", &SstFileWriterWrapper::finish)
+        .def("file_size", &SstFileWriterWrapper::file_size);
+
+    // Register BackupEngine class
+    py::class_<BackupEngineWrapper>(m, "cBackupEngine")
+        .def_static("open", &BackupEngineWrapper::open, "options"_a)
+        .def("create_new_backup", &BackupEngineWrapper::create_new_backup, "db"_a, "flush_before_backup"_a = false, 
+             "app_metadata"_a = "", "progress"_a = py::none())
+        .def("get_backup_info", &BackupEngineWrapper::get_backup_info)
+        .def("verify_backup", &BackupEngineWrapper::verify_backup, "backup_id"_a, "verify_with_checksum"_a = false)
+        .def("restore_db_from_backup", &BackupEngineWrapper::restore_db_from_backup, "backup_id"_a, "db_dir"_a, "wal_dir"_a, 
+             "keep_log_files"_a = false)
+        .def("purge_old_backups", &BackupEngineWrapper::purge_old_backups, "num_backups_to_keep"_a)
+        .def("delete_backup", &BackupEngineWrapper::delete_backup, "backup_id"_a)
+        .def("garbage_collect", &BackupEngineWrapper::garbage_collect)
+        .def("close", &BackupEngineWrapper::close);
+
+    m.def("write_sst_files", &write_sst_files, "db_options"_a, "cf_options"_a, "directory"_a, "prefix"_a, "items"_a, 
+          "partitions"_a, "threads"_a = 0, "memory_limit"_a = 256 << 20);
+
     // Register WriteBatch class
     py::class_<WriteBatchWrapper>(m, "cWriteBatch")
         .def(py::init<>())
+        .def_static("from_data", &WriteBatchWrapper::from_data, "data"_a)
         .def("put", &WriteBatchWrapper::put)
+        .def("merge", &WriteBatchWrapper::merge)
         .def("delete", &WriteBatchWrapper::delete_key)
+        .def("delete_range", &WriteBatchWrapper::delete_range)
+        .def("put_many", &WriteBatchWrapper::put_many, "cfh"_a, "keys"_a, "values"_a)
+        .def("put_packed", &WriteBatchWrapper::put_packed, "cfh"_a, "key_buffer"_a, "key_offsets"_a, "value_buffer"_a, 
+             "value_offsets"_a)
         .def("clear", &WriteBatchWrapper::clear)
-        .def("count", &WriteBatchWrapper::count);
+        .def("count", &WriteBatchWrapper::count)
+        .def("data_size", &WriteBatchWrapper::data_size)
+        .def("data", &WriteBatchWrapper::data);
 
     // Register enums
     py::enum_<rocksdb::CompressionType>(m, "CompressionType")
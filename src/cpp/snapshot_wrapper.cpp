@@ -0,0 +1,24 @@
+#include "snapshot_wrapper.h"
+#include "db_wrapper.h"
+#include <mutex>
+#include <stdexcept>
+
+SnapshotWrapper::~SnapshotWrapper() {
+    release();
+}
+
+void SnapshotWrapper::release() {
+    owner->release_snapshot(*this);
+}
+
+bool SnapshotWrapper::valid() const {
+    std::shared_lock lock(mutex);
+    return snapshot != nullptr;
+}
+
+uint64_t SnapshotWrapper::sequence_number() const {
+    std::shared_lock lock(mutex);
+    if (snapshot == nullptr)
+        throw std::runtime_error("Snapshot has been released");
+    return snapshot->GetSequenceNumber();
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <rocksdb/db.h>
+#include <cstdint>
+#include <shared_mutex>
+
+namespace rdb = rocksdb;
+
+class DBWrapper;
+
+// A snapshot owned by Python. It is released when the object is collected,
+// on an explicit release() or when the owning DB is closed, whichever comes
+// first; afterwards it can no longer be used for reads.
+class SnapshotWrapper {
+public:
+    SnapshotWrapper(DBWrapper* owner, const rdb::Snapshot* snapshot) :
+        owner(owner), snapshot(snapshot) {}
+    ~SnapshotWrapper();
+
+    void release();
+    bool valid() const;
+    uint64_t sequence_number() const;
+
+private:
+    friend class DBWrapper;
+
+    DBWrapper* owner;
+    const rdb::Snapshot* snapshot;
+    // Reads hold it shared while RocksDB uses the snapshot, release() and
+    // DBWrapper::close() hold it exclusively to drop it.
+    mutable std::shared_mutex mutex;
+};
@@ -0,0 +1,434 @@
+#include "sst_file_writer_wrapper.h"
+#include "helpers.h"
+#include <rocksdb/comparator.h>
+#include <rocksdb/env.h>
+#include <rocksdb/sst_file_reader.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+using namespace py::literals;
+
+SstFileWriterWrapper::SstFileWriterWrapper(const rdb::DBOptions& db_options, const rdb::ColumnFamilyOptions& cf_options)
+    : options_(db_options, cf_options), writer_(new rdb::SstFileWriter(rdb::EnvOptions(), options_)) {}
+
+void SstFileWriterWrapper::open(const std::string& path) {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex_);
+        status = writer_->Open(path);
+        opened_ = status.ok();
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to open SST file: " + status.ToString());
+    }
+}
+
+void SstFileWriterWrapper::put(const py::bytes& key, const py::bytes& value) {
+    std::lock_guard lock(mutex_);
+    check_open();
+    auto status = writer_->Put(toslice(key), toslice(value));
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to add key to SST file: " + status.ToString());
+    }
+}
+
+void SstFileWriterWrapper::delete_key(const py::bytes& key) {
+    std::lock_guard lock(mutex_);
+    check_open();
+    auto status = writer_->Delete(toslice(key));
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to add delete to SST file: " + status.ToString());
+    }
+}
+
+void SstFileWriterWrapper::put_many(const KeyValueList& items) {
+    std::vector<std::pair<rdb::Slice, rdb::Slice>> slices;
+    slices.reserve(items.size());
+    for (const auto& [key, value] : items)
+        slices.emplace_back(toslice(key), toslice(value));
+
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex_);
+        check_open();
+        for (const auto& [key, value] : slices) {
+            status = writer_->Put(key, value);
+            if (!status.ok())
+                break;
+        }
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to add key to SST file: " + status.ToString());
+    }
+}
+
+py::dict SstFileWriterWrapper::finish() {
+    rdb::ExternalSstFileInfo info;
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex_);
+        check_open();
+        status = writer_->Finish(&info);
+        opened_ = false;
+    }
+    if (!status.ok()) {
+        throw std::runtime_error("Failed to finish SST file: " + status.ToString());
+    }
+    return py::dict(
+        "file_path"_a = info.file_path,
+        "smallest_key"_a = py::bytes(info.smallest_key),
+        "largest_key"_a = py::bytes(info.largest_key),
+        "num_entries"_a = info.num_entries,
+        "file_size"_a = info.file_size);
+}
+
+uint64_t SstFileWriterWrapper::file_size() const {
+    std::lock_guard lock(mutex_);
+    return writer_->FileSize();
+}
+
+namespace {
+typedef std::pair<rdb::Slice, rdb::Slice> KV;
+
+// Part of the input copied out of Python, so that it can be sorted and
+// written without the GIL
+class Chunk {
+public:
+    void add(const rdb::Slice& key, const rdb::Slice& value) {
+        entries.push_back({data.size(), key.size(), value.size()});
+        data.append(key.data(), key.size());
+        data.append(value.data(), value.size());
+    }
+    // Memory held, counting the key/value slices built for sorting
+    size_t bytes() const { return data.size() + entries.size() * (sizeof(Entry) + sizeof(KV)); }
+    bool empty() const { return entries.empty(); }
+    void clear() { data.clear(); entries.clear(); }
+
+    // Valid until the next add() or clear()
+    std::vector<KV> slices() const {
+        std::vector<KV> rv;
+        rv.reserve(entries.size());
+        for (const Entry& e : entries)
+            rv.emplace_back(rdb::Slice(data.data() + e.offset, e.key_size),
+                            rdb::Slice(data.data() + e.offset + e.key_size, e.value_size));
+        return rv;
+    }
+
+private:
+    struct Entry {
+        size_t offset, key_size, value_size;
+    };
+    std::string data;
+    std::vector<Entry> entries;
+};
+
+// Uniform sample of all keys seen, to pick range split points from
+class KeySample {
+public:
+    explicit KeySample(size_t capacity) : capacity(capacity) {}
+
+    void add(const rdb::Slice& key) {
+        seen++;
+        if (keys.size() < capacity) {
+            keys.emplace_back(key.data(), key.size());
+            return;
+        }
+        uint64_t i = std::uniform_int_distribution<uint64_t>(0, seen - 1)(rng);
+        if (i < capacity)
+            keys[i].assign(key.data(), key.size());
+    }
+
+    // Up to parts - 1 increasing split points
+    std::vector<std::string> splitters(size_t parts, const rdb::Comparator* cmp) const {
+        std::vector<rdb::Slice> sorted(keys.begin(), keys.end());
+        std::sort(sorted.begin(), sorted.end(), [cmp](const rdb::Slice& a, const rdb::Slice& b) {
+            return cmp->Compare(a, b) < 0;
+        });
+
+        std::vector<std::string> rv;
+        for (size_t i = 1; i < parts && !sorted.empty(); i++) {
+            const rdb::Slice& s = sorted[i * sorted.size() / parts];
+            // Equal split points would only produce empty parts
+            if (rv.empty() || cmp->Compare(rv.back(), s) < 0)
+                rv.push_back(s.ToString());
+        }
+        return rv;
+    }
+
+private:
+    size_t capacity;
+    uint64_t seen = 0;
+    std::vector<std::string> keys;
+    std::mt19937_64 rng;
+};
+
+// Runs task(0) .. task(n - 1) on up to `threads` threads
+std::vector<rdb::Status> helper_parallel(size_t n, size_t threads, const std::function<rdb::Status(size_t)>& task) {
+    std::vector<rdb::Status> statuses(n);
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < n; i = next++)
+            statuses[i] = task(i);
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < std::min(threads, n); t++)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& thread : pool)
+        thread.join();
+    return statuses;
+}
+
+// Empty if every task succeeded
+std::string helper_first_error(const std::vector<rdb::Status>& statuses, const std::vector<std::string>& paths) {
+    for (size_t i = 0; i < statuses.size(); i++) {
+        if (!statuses[i].ok())
+            return "Failed to write SST file " + paths[i] + ": " + statuses[i].ToString();
+    }
+    return {};
+}
+
+rdb::Status helper_write_partition(const rdb::Options& options, const std::string& path, std::vector<KV>& part, 
+    rdb::ExternalSstFileInfo* info) {
+    const rdb::Comparator* cmp = options.comparator;
+    // Stable, so that of several equal keys the one added last comes last
+    std::stable_sort(part.begin(), part.end(), [cmp](const KV& a, const KV& b) {
+        return cmp->Compare(a.first, b.first) < 0;
+    });
+
+    rdb::SstFileWriter writer(rdb::EnvOptions(), options);
+    rdb::Status status = writer.Open(path);
+    for (size_t i = 0; status.ok() && i < part.size(); i++) {
+        if (i + 1 < part.size() && cmp->Equal(part[i].first, part[i + 1].first))
+            continue;
+        status = writer.Put(part[i].first, part[i].second);
+    }
+    if (status.ok())
+        status = writer.Finish(info);
+    return status;
+}
+
+// Splits `items` at `splitters` and writes part i, sorted, to paths[i] on up
+// to `threads` threads. Parts left empty are not written and keep an empty info.
+std::vector<rdb::Status> helper_write_parts(const rdb::Options& options, const std::vector<KV>& items,
+    const std::vector<std::string>& splitters, const std::vector<std::string>& paths, size_t threads,
+    std::vector<rdb::ExternalSstFileInfo>& infos) {
+    const rdb::Comparator* cmp = options.comparator;
+    std::vector<std::vector<KV>> parts(splitters.size() + 1);
+    for (const KV& kv : items) {
+        auto it = std::upper_bound(splitters.begin(), splitters.end(), kv.first, [cmp](const rdb::Slice& key, const std::string& s) {
+            return cmp->Compare(key, s) < 0;
+        });
+        parts[it - splitters.begin()].push_back(kv);
+    }
+
+    infos.assign(parts.size(), rdb::ExternalSstFileInfo());
+    return helper_parallel(parts.size(), threads, [&](size_t i) {
+        return parts[i].empty() ? rdb::Status::OK() : helper_write_partition(options, paths[i], parts[i], &infos[i]);
+    });
+}
+
+// Merges the keys in [lower, upper) of the sorted runs into one file at
+// `path`, which is not created if there are none. Runs are ordered oldest
+// first; of equal keys the one from the newest run wins.
+rdb::Status helper_merge_partition(const rdb::Options& options, const std::vector<rdb::ExternalSstFileInfo>& runs,
+    const std::string* lower, const std::string* upper, const std::string& path, rdb::ExternalSstFileInfo* info) {
+    const rdb::Comparator* cmp = options.comparator;
+    rdb::Slice upper_slice;
+    rdb::ReadOptions read_options;
+    read_options.fill_cache = false;
+    if (upper) {
+        upper_slice = *upper;
+        read_options.iterate_upper_bound = &upper_slice;
+    }
+
+    struct Source {
+        std::unique_ptr<rdb::SstFileReader> reader;
+        std::unique_ptr<rdb::Iterator> iter;
+        size_t run;
+    };
+    std::vector<Source> sources;
+    for (size_t r = 0; r < runs.size(); r++) {
+        const auto& run = runs[r];
+        if ((lower && cmp->Compare(run.largest_key, *lower) < 0) || (upper && cmp->Compare(run.smallest_key, *upper) >= 0))
+            continue;
+        Source source{std::make_unique<rdb::SstFileReader>(options), nullptr, r};
+        rdb::Status status = source.reader->Open(run.file_path);
+        if (!status.ok())
+            return status;
+        source.iter.reset(source.reader->NewIterator(read_options));
+        if (lower)
+            source.iter->Seek(*lower);
+        else
+            source.iter->SeekToFirst();
+        if (!source.iter->status().ok())
+            return source.iter->status();
+        if (source.iter->Valid())
+            sources.push_back(std::move(source));
+    }
+
+    // Smallest key on top, and of equal keys the one from the newest run
+    auto below = [cmp, &sources](size_t a, size_t b) {
+        int c = cmp->Compare(sources[a].iter->key(), sources[b].iter->key());
+        return c != 0 ? c > 0 : sources[a].run < sources[b].run;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(below)> heap(below);
+    for (size_t i = 0; i < sources.size(); i++)
+        heap.push(i);
+
+    std::unique_ptr<rdb::SstFileWriter> writer;
+    std::string last;
+    rdb::Status status;
+    while (status.ok() && !heap.empty()) {
+        size_t i = heap.top();
+        heap.pop();
+        rdb::Iterator* iter = sources[i].iter.get();
+        if (!writer) {
+            writer = std::make_unique<rdb::SstFileWriter>(rdb::EnvOptions(), options);
+            status = writer->Open(path);
+            if (status.ok())
+                status = writer->Put(iter->key(), iter->value());
+            last = iter->key().ToString();
+        }
+        else if (!cmp->Equal(iter->key(), last)) {
+            status = writer->Put(iter->key(), iter->value());
+            last = iter->key().ToString();
+        }
+        iter->Next();
+        if (iter->Valid())
+            heap.push(i);
+        else if (status.ok())
+            status = iter->status();
+    }
+    if (status.ok() && writer)
+        status = writer->Finish(info);
+    return status;
+}
+
+void helper_remove_files(const std::vector<std::string>& paths) {
+    for (const auto& path : paths)
+        std::remove(path.c_str());
+}
+}
+
+py::list write_sst_files(const rdb::DBOptions& db_options, const rdb::ColumnFamilyOptions& cf_options,
+    const std::string& directory, const std::string& prefix, const py::iterable& items, size_t partitions, size_t threads,
+    size_t memory_limit) {
+    if (partitions == 0)
+        throw std::invalid_argument("partitions must be at least 1");
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    const rdb::Options options(db_options, cf_options);
+    const rdb::Comparator* cmp = options.comparator;
+    auto file_name = [&](const char* kind, size_t i) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%s-%06zu.sst", kind, i);
+        return directory + "/" + prefix + name;
+    };
+
+    Chunk chunk;
+    KeySample sample(partitions * 256);
+    // Sorted runs spilled so far, oldest first, and every file they may have left
+    std::vector<rdb::ExternalSstFileInfo> runs;
+    std::vector<std::string> run_paths;
+    std::vector<rdb::ExternalSstFileInfo> infos;
+    std::vector<std::string> paths;
+
+    // Sorts the chunk into a run; split so that it is sorted on all threads
+    auto spill = [&]() {
+        std::vector<std::string> splitters = sample.splitters(threads, cmp);
+        std::vector<std::string> part_paths;
+        for (size_t i = 0; i <= splitters.size(); i++) {
+            part_paths.push_back(file_name("-run", run_paths.size()));
+            run_paths.push_back(part_paths.back());
+        }
+        std::vector<rdb::ExternalSstFileInfo> part_infos;
+        std::string error = helper_first_error(
+            helper_write_parts(options, chunk.slices(), splitters, part_paths, threads, part_infos), part_paths);
+        for (auto& info : part_infos) {
+            if (!info.file_path.empty())
+                runs.push_back(std::move(info));
+        }
+        chunk.clear();
+        return error;
+    };
+
+    auto finish = [&]() {
+        std::string error;
+        if (!runs.empty() && !chunk.empty())
+            error = spill();
+        if (!error.empty() || (runs.empty() && chunk.empty()))
+            return error;
+
+        std::vector<std::string> splitters = sample.splitters(partitions, cmp);
+        for (size_t i = 0; i <= splitters.size(); i++)
+            paths.push_back(file_name("", i));
+        if (runs.empty()) {
+            // Everything fit in memory
+            return helper_first_error(helper_write_parts(options, chunk.slices(), splitters, paths, threads, infos), paths);
+        }
+        infos.assign(paths.size(), rdb::ExternalSstFileInfo());
+        return helper_first_error(helper_parallel(paths.size(), threads, [&](size_t i) {
+            return helper_merge_partition(options, runs, i > 0 ? &splitters[i - 1] : nullptr,
+                i < splitters.size() ? &splitters[i] : nullptr, paths[i], &infos[i]);
+        }), paths);
+    };
+
+    std::string error;
+    try {
+        for (py::handle item : items) {
+            auto kv = item.cast<std::pair<py::bytes, py::bytes>>();
+            rdb::Slice key = toslice(kv.first);
+            chunk.add(key, toslice(kv.second));
+            sample.add(key);
+            if (chunk.bytes() >= memory_limit) {
+                py::gil_scoped_release release;
+                error = spill();
+                if (!error.empty())
+                    break;
+            }
+        }
+        if (error.empty()) {
+            py::gil_scoped_release release;
+            error = finish();
+        }
+    }
+    catch (...) {
+        helper_remove_files(run_paths);
+        throw;
+    }
+
+    {
+        py::gil_scoped_release release;
+        // The runs are merged into the output files by now, or abandoned
+        helper_remove_files(run_paths);
+        if (!error.empty())
+            helper_remove_files(paths);
+    }
+    if (!error.empty()) {
+        throw std::runtime_error(error);
+    }
+
+    py::list rv;
+    for (const auto& info : infos) {
+        if (info.file_path.empty())
+            continue;
+        rv.append(py::dict(
+            "file_path"_a = info.file_path,
+            "smallest_key"_a = py::bytes(info.smallest_key),
+            "largest_key"_a = py::bytes(info.largest_key),
+            "num_entries"_a = info.num_entries,
+            "file_size"_a = info.file_size));
+    }
+    return rv;
+}
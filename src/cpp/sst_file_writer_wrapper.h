@@ -0,0 +1,51 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <rocksdb/options.h>
+#include <rocksdb/sst_file_writer.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace py  = pybind11;
+namespace rdb = rocksdb;
+
+typedef std::vector<std::pair<py::bytes, py::bytes>> KeyValueList;
+
+// Builds an SST file offline for DBWrapper::ingest_external_file. Keys must be
+// added in strictly increasing order of the column family's comparator.
+class SstFileWriterWrapper {
+public:
+    SstFileWriterWrapper(const rdb::DBOptions& db_options, const rdb::ColumnFamilyOptions& cf_options);
+
+    void open(const std::string& path);
+    void put(const py::bytes& key, const py::bytes& value);
+    void delete_key(const py::bytes& key);
+    // Adds a whole sorted chunk with the GIL released
+    void put_many(const KeyValueList& items);
+    py::dict finish();
+    uint64_t file_size() const;
+
+private:
+    void check_open() const { if(!opened_) throw std::runtime_error("SstFileWriter is not open"); }
+
+    rdb::Options options_;
+    std::unique_ptr<rdb::SstFileWriter> writer_;
+    bool opened_ = false;
+    // Chunks are added without the GIL
+    mutable std::mutex mutex_;
+};
+
+// Sorts an unsorted iterable of (key, value) pairs and writes it as up to
+// `partitions` non-overlapping SST files named <directory>/<prefix>-NNNNNN.sst,
+// using up to `threads` worker threads. The input is copied in chunks of about
+// `memory_limit` bytes; when it does not fit in one, each chunk is sorted into
+// a run of temporary <prefix>-run-NNNNNN.sst files and the runs are merged at
+// the end. For duplicate keys the last one wins. On failure no files are left
+// behind. Returns file_path, smallest_key, largest_key, num_entries and
+// file_size of each file written, in key order.
+py::list write_sst_files(const rdb::DBOptions& db_options, const rdb::ColumnFamilyOptions& cf_options,
+    const std::string& directory, const std::string& prefix, const py::iterable& items, size_t partitions, size_t threads,
+    size_t memory_limit);
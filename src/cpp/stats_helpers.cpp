@@ -0,0 +1,111 @@
+#include "stats_helpers.h"
+#include <rocksdb/perf_context.h>
+#include <rocksdb/iostats_context.h>
+#include <utility>
+
+using namespace py::literals;
+
+py::dict statistics_to_dict(const rocksdb::Statistics& stats) {
+    py::dict tickers;
+    for (const auto& [ticker, name] : rocksdb::TickersNameMap)
+        tickers[py::str(name)] = stats.getTickerCount(ticker);
+
+    py::dict histograms;
+    for (const auto& [histogram, name] : rocksdb::HistogramsNameMap) {
+        rocksdb::HistogramData data;
+        stats.histogramData(histogram, &data);
+        histograms[py::str(name)] = py::dict(
+            "count"_a = data.count,
+            "sum"_a = data.sum,
+            "min"_a = data.min,
+            "max"_a = data.max,
+            "average"_a = data.average,
+            "median"_a = data.median,
+            "p95"_a = data.percentile95,
+            "p99"_a = data.percentile99,
+            "stddev"_a = data.standard_deviation);
+    }
+
+    return py::dict("tickers"_a = tickers, "histograms"_a = histograms);
+}
+
+namespace {
+const std::pair<const char*, uint64_t rocksdb::PerfContext::*> kPerfCounters[] = {
+    {"user_key_comparison_count", &rocksdb::PerfContext::user_key_comparison_count},
+    {"block_cache_hit_count", &rocksdb::PerfContext::block_cache_hit_count},
+    {"block_read_count", &rocksdb::PerfContext::block_read_count},
+    {"block_read_byte", &rocksdb::PerfContext::block_read_byte},
+    {"block_read_time", &rocksdb::PerfContext::block_read_time},
+    {"block_checksum_time", &rocksdb::PerfContext::block_checksum_time},
+    {"block_decompress_time", &rocksdb::PerfContext::block_decompress_time},
+    {"block_cache_index_hit_count", &rocksdb::PerfContext::block_cache_index_hit_count},
+    {"block_cache_filter_hit_count", &rocksdb::PerfContext::block_cache_filter_hit_count},
+    {"index_block_read_count", &rocksdb::PerfContext::index_block_read_count},
+    {"filter_block_read_count", &rocksdb::PerfContext::filter_block_read_count},
+    {"get_read_bytes", &rocksdb::PerfContext::get_read_bytes},
+    {"multiget_read_bytes", &rocksdb::PerfContext::multiget_read_bytes},
+    {"iter_read_bytes", &rocksdb::PerfContext::iter_read_bytes},
+    {"internal_key_skipped_count", &rocksdb::PerfContext::internal_key_skipped_count},
+    {"internal_delete_skipped_count", &rocksdb::PerfContext::internal_delete_skipped_count},
+    {"internal_recent_skipped_count", &rocksdb::PerfContext::internal_recent_skipped_count},
+    {"internal_merge_count", &rocksdb::PerfContext::internal_merge_count},
+    {"get_snapshot_time", &rocksdb::PerfContext::get_snapshot_time},
+    {"get_from_memtable_time", &rocksdb::PerfContext::get_from_memtable_time},
+    {"get_from_memtable_count", &rocksdb::PerfContext::get_from_memtable_count},
+    {"get_post_process_time", &rocksdb::PerfContext::get_post_process_time},
+    {"get_from_output_files_time", &rocksdb::PerfContext::get_from_output_files_time},
+    {"seek_on_memtable_time", &rocksdb::PerfContext::seek_on_memtable_time},
+    {"seek_on_memtable_count", &rocksdb::PerfContext::seek_on_memtable_count},
+    {"next_on_memtable_count", &rocksdb::PerfContext::next_on_memtable_count},
+    {"prev_on_memtable_count", &rocksdb::PerfContext::prev_on_memtable_count},
+    {"seek_child_seek_time", &rocksdb::PerfContext::seek_child_seek_time},
+    {"seek_child_seek_count", &rocksdb::PerfContext::seek_child_seek_count},
+    {"seek_internal_seek_time", &rocksdb::PerfContext::seek_internal_seek_time},
+    {"find_next_user_entry_time", &rocksdb::PerfContext::find_next_user_entry_time},
+    {"write_wal_time", &rocksdb::PerfContext::write_wal_time},
+    {"write_memtable_time", &rocksdb::PerfContext::write_memtable_time},
+    {"write_delay_time", &rocksdb::PerfContext::write_delay_time},
+    {"write_scheduling_flushes_compactions_time", &rocksdb::PerfContext::write_scheduling_flushes_compactions_time},
+    {"write_pre_and_post_process_time", &rocksdb::PerfContext::write_pre_and_post_process_time},
+    {"write_thread_wait_nanos", &rocksdb::PerfContext::write_thread_wait_nanos},
+    {"db_mutex_lock_nanos", &rocksdb::PerfContext::db_mutex_lock_nanos},
+    {"db_condition_wait_nanos", &rocksdb::PerfContext::db_condition_wait_nanos},
+    {"bloom_memtable_hit_count", &rocksdb::PerfContext::bloom_memtable_hit_count},
+    {"bloom_memtable_miss_count", &rocksdb::PerfContext::bloom_memtable_miss_count},
+    {"bloom_sst_hit_count", &rocksdb::PerfContext::bloom_sst_hit_count},
+    {"bloom_sst_miss_count", &rocksdb::PerfContext::bloom_sst_miss_count},
+    {"key_lock_wait_time", &rocksdb::PerfContext::key_lock_wait_time},
+    {"key_lock_wait_count", &rocksdb::PerfContext::key_lock_wait_count},
+};
+
+const std::pair<const char*, uint64_t rocksdb::IOStatsContext::*> kIOStatsCounters[] = {
+    {"bytes_written", &rocksdb::IOStatsContext::bytes_written},
+    {"bytes_read", &rocksdb::IOStatsContext::bytes_read},
+    {"open_nanos", &rocksdb::IOStatsContext::open_nanos},
+    {"allocate_nanos", &rocksdb::IOStatsContext::allocate_nanos},
+    {"write_nanos", &rocksdb::IOStatsContext::write_nanos},
+    {"read_nanos", &rocksdb::IOStatsContext::read_nanos},
+    {"range_sync_nanos", &rocksdb::IOStatsContext::range_sync_nanos},
+    {"fsync_nanos", &rocksdb::IOStatsContext::fsync_nanos},
+    {"prepare_write_nanos", &rocksdb::IOStatsContext::prepare_write_nanos},
+    {"logger_nanos", &rocksdb::IOStatsContext::logger_nanos},
+    {"cpu_write_nanos", &rocksdb::IOStatsContext::cpu_write_nanos},
+    {"cpu_read_nanos", &rocksdb::IOStatsContext::cpu_read_nanos},
+};
+}
+
+py::dict perf_context_to_dict() {
+    const rocksdb::PerfContext* ctx = rocksdb::get_perf_context();
+    py::dict rv;
+    for (const auto& [name, field] : kPerfCounters)
+        rv[name] = ctx->*field;
+    return rv;
+}
+
+py::dict iostats_context_to_dict() {
+    const rocksdb::IOStatsContext* ctx = rocksdb::get_iostats_context();
+    py::dict rv;
+    for (const auto& [name, field] : kIOStatsCounters)
+        rv[name] = ctx->*field;
+    return rv;
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <rocksdb/statistics.h>
+
+namespace py = pybind11;
+
+// {"tickers": {name: count}, "histograms": {name: {count, sum, min, max, average, median, p95, p99, stddev}}}
+py::dict statistics_to_dict(const rocksdb::Statistics& stats);
+
+// Counters of the calling thread's PerfContext / IOStatsContext
+py::dict perf_context_to_dict();
+py::dict iostats_context_to_dict();
@@ -0,0 +1,154 @@
+#include "transaction_wrapper.h"
+#include "db_wrapper.h"
+#include "helpers.h"
+#include <string>
+
+void helper_check_txn_status(const rdb::Status& status, const std::string& what) {
+    if (status.ok())
+        return;
+    if (status.IsBusy() || status.IsTryAgain() || status.IsTimedOut() || status.IsDeadlock())
+        throw TransactionConflict(what + ": " + status.ToString());
+    throw std::runtime_error(what + ": " + status.ToString());
+}
+
+TransactionWrapper::~TransactionWrapper() {
+    owner->release_transaction(*this);
+}
+
+void TransactionWrapper::check_open(ColumnFamilyHandle* cfh) const {
+    if (!txn)
+        throw std::runtime_error("Transaction has been closed");
+    if (cfh && !cfh->check_db(db))
+        throw std::runtime_error("Invalid column family");
+}
+
+void TransactionWrapper::put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value) {
+    rdb::Slice key_slice = toslice(key), value_slice = toslice(value);
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        check_open(&cfh);
+        status = txn->Put(cfh.get_cf_handle(), key_slice, value_slice);
+    }
+    helper_check_txn_status(status, "Failed to put key-value");
+}
+
+void TransactionWrapper::delete_key(ColumnFamilyHandle cfh, const py::bytes& key) {
+    rdb::Slice key_slice = toslice(key);
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        check_open(&cfh);
+        status = txn->Delete(cfh.get_cf_handle(), key_slice);
+    }
+    helper_check_txn_status(status, "Failed to delete key");
+}
+
+void TransactionWrapper::merge(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value) {
+    rdb::Slice key_slice = toslice(key), value_slice = toslice(value);
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        check_open(&cfh);
+        status = txn->Merge(cfh.get_cf_handle(), key_slice, value_slice);
+    }
+    helper_check_txn_status(status, "Failed to merge value");
+}
+
+std::optional<py::bytes> TransactionWrapper::read(ColumnFamilyHandle cfh, const py::bytes& key, const ReadOptionsWrapper* opts, 
+    bool for_update, bool exclusive) {
+    if (opts && opts->snapshot_handle)
+        throw std::invalid_argument("Transactions read at their own snapshot; ReadOptions.snapshot is not supported");
+    rdb::Slice key_slice = toslice(key);
+    rdb::ReadOptions read_options = opts ? *opts : rdb::ReadOptions();
+    std::string value;
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        check_open(&cfh);
+        read_options.snapshot = txn->GetSnapshot();
+        if (for_update)
+            status = txn->GetForUpdate(read_options, cfh.get_cf_handle(), key_slice, &value, exclusive);
+        else
+            status = txn->Get(read_options, cfh.get_cf_handle(), key_slice, &value);
+    }
+    if (status.IsNotFound())
+        return std::nullopt;
+    helper_check_txn_status(status, "Failed to get value");
+    return py::bytes(value);
+}
+
+std::optional<py::bytes> TransactionWrapper::get(ColumnFamilyHandle cfh, const py::bytes& key, const ReadOptionsWrapper* opts) {
+    return read(cfh, key, opts, false, false);
+}
+
+std::optional<py::bytes> TransactionWrapper::get_for_update(ColumnFamilyHandle cfh, const py::bytes& key, bool exclusive, 
+    const ReadOptionsWrapper* opts) {
+    return read(cfh, key, opts, true, exclusive);
+}
+
+void TransactionWrapper::set_savepoint() {
+    std::lock_guard lock(mutex);
+    check_open();
+    txn->SetSavePoint();
+}
+
+void TransactionWrapper::rollback_to_savepoint() {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        check_open();
+        status = txn->RollbackToSavePoint();
+    }
+    helper_check_txn_status(status, "Failed to roll back to savepoint");
+}
+
+void TransactionWrapper::pop_savepoint() {
+    std::lock_guard lock(mutex);
+    check_open();
+    helper_check_txn_status(txn->PopSavePoint(), "Failed to pop savepoint");
+}
+
+void TransactionWrapper::set_snapshot() {
+    std::lock_guard lock(mutex);
+    check_open();
+    txn->SetSnapshot();
+}
+
+bool TransactionWrapper::has_snapshot() const {
+    std::lock_guard lock(mutex);
+    check_open();
+    return txn->GetSnapshot() != nullptr;
+}
+
+void TransactionWrapper::commit() {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        check_open();
+        status = txn->Commit();
+    }
+    helper_check_txn_status(status, "Failed to commit transaction");
+}
+
+void TransactionWrapper::rollback() {
+    rdb::Status status;
+    {
+        py::gil_scoped_release release;
+        std::lock_guard lock(mutex);
+        check_open();
+        status = txn->Rollback();
+    }
+    helper_check_txn_status(status, "Failed to roll back transaction");
+}
+
+bool TransactionWrapper::valid() const {
+    std::lock_guard lock(mutex);
+    return txn != nullptr;
+}
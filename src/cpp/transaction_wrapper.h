@@ -0,0 +1,67 @@
+#pragma once
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <rocksdb/db.h>
+#include <rocksdb/utilities/transaction.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include "cf_handle.h"
+#include "read_options.h"
+
+namespace py  = pybind11;
+namespace rdb = rocksdb;
+
+class DBWrapper;
+
+// Raised for write conflicts, lock timeouts and deadlocks; the transaction
+// can be rolled back and retried. Exposed as a subclass of RuntimeError.
+class TransactionConflict : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// A transaction of a TransactionDB or OptimisticTransactionDB. Like
+// SnapshotWrapper it is registered with its DBWrapper, which rolls it back
+// when the DB is closed first.
+class TransactionWrapper {
+public:
+    TransactionWrapper(DBWrapper* owner, rdb::DB* db, rdb::Transaction* txn) :
+        owner(owner), db(db), txn(txn) {}
+    ~TransactionWrapper();
+
+    void put(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value);
+    void delete_key(ColumnFamilyHandle cfh, const py::bytes& key);
+    void merge(ColumnFamilyHandle cfh, const py::bytes& key, const py::bytes& value);
+    // Reads see the transaction's own writes, as of its snapshot if it has one
+    std::optional<py::bytes> get(ColumnFamilyHandle cfh, const py::bytes& key, const ReadOptionsWrapper* opts);
+    // Also locks the key (pessimistic) or tracks it for conflict checking at
+    // commit (optimistic)
+    std::optional<py::bytes> get_for_update(ColumnFamilyHandle cfh, const py::bytes& key, bool exclusive, const ReadOptionsWrapper* opts);
+
+    void set_savepoint();
+    void rollback_to_savepoint();
+    void pop_savepoint();
+    void set_snapshot();
+    bool has_snapshot() const;
+
+    void commit();
+    void rollback();
+    bool valid() const;
+
+private:
+    friend class DBWrapper;
+
+    // Caller holds mutex
+    void check_open(ColumnFamilyHandle* cfh = nullptr) const;
+    std::optional<py::bytes> read(ColumnFamilyHandle cfh, const py::bytes& key, const ReadOptionsWrapper* opts, 
+                                  bool for_update, bool exclusive);
+
+    DBWrapper* owner;
+    rdb::DB* db;
+    std::unique_ptr<rdb::Transaction> txn;
+    // Every call runs without the GIL - pessimistic ones can wait on locks -
+    // and holds this; DBWrapper::close() takes it to drop the transaction.
+    mutable std::mutex mutex;
+};
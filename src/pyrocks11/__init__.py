@@ -1,10 +1,26 @@
 from .db import RocksDB
 from .options import DBOptions, CFOptions
 from .iterator import DbIterator
+from .columnar import ColumnarBatch
 from .batch import WriteBatch
-from ._rocksdb_cpp import CompressionType, cCFHandle, DbOpenRW, DbOpenRO, PlainTableOptions, EncodingType # type: ignore
-from ._rocksdb_cpp import CompactRangeOptions, BlobGarbageCollectionPolicy, BottommostLevelCompaction # type: ignore
+from .snapshot import Snapshot
+from .transaction import Transaction
+from .aio import AsyncRocksDB
+from .group_commit import GroupCommitWriter
+from .parallel_scan import ParallelScan
+from .backup import BackupEngine
+from .perf import PerfContext
+from .sst import SstFileWriter, write_sst_files
+from ._rocksdb_cpp import CompressionType, cCFHandle, DbOpenRW, DbOpenRO, DbOpenTTL, DbOpenSecondary, DbOpenOptimisticTransaction, DbOpenTransaction, Env, MockTimeEnv, PlainTableOptions, EncodingType # type: ignore
+from ._rocksdb_cpp import CompactRangeOptions, BlobGarbageCollectionPolicy, BottommostLevelCompaction, IteratorOptions, PinnedValue # type: ignore
+from ._rocksdb_cpp import Cache, BlockBasedTableOptions, DataBlockIndexType, ChecksumType, FilterPolicy, PrefixExtractor # type: ignore
+from ._rocksdb_cpp import Statistics, StatsLevel, PerfLevel # type: ignore
+from ._rocksdb_cpp import ReadOptions, WriteOptions, ReadTier, IOPriority, MergeOperator, CompactionFilter, TransactionConflict, BackupEngineOptions # type: ignore
 
-__all__ = ['RocksDB', 'DBOptions', 'CFOptions', 'DbIterator', 'WriteBatch', 'PlainTableOptions', 'EncodingType',
-           'DbOpenRW', 'DbOpenRO',  'CompressionType', 'cCFHandle', 'CompactRangeOptions', 'BlobGarbageCollectionPolicy', 'BottommostLevelCompaction']
+__all__ = ['RocksDB', 'AsyncRocksDB', 'DBOptions', 'CFOptions', 'DbIterator', 'ColumnarBatch', 'WriteBatch', 'Snapshot', 'Transaction', 'GroupCommitWriter', 'ParallelScan', 'BackupEngine', 'BackupEngineOptions', 'PlainTableOptions', 'EncodingType',
+           'DbOpenRW', 'DbOpenRO', 'DbOpenTTL', 'DbOpenSecondary', 'DbOpenOptimisticTransaction', 'DbOpenTransaction', 'Env', 'MockTimeEnv', 'CompressionType', 'cCFHandle', 'CompactRangeOptions', 'BlobGarbageCollectionPolicy', 'BottommostLevelCompaction',
+           'IteratorOptions', 'PinnedValue', 'Cache', 'BlockBasedTableOptions', 'DataBlockIndexType', 'ChecksumType',
+           'FilterPolicy', 'PrefixExtractor', 'Statistics', 'StatsLevel', 'PerfLevel', 'PerfContext',
+           'ReadOptions', 'WriteOptions', 'ReadTier', 'IOPriority', 'SstFileWriter', 'write_sst_files',
+           'MergeOperator', 'CompactionFilter', 'TransactionConflict']
 
@@ -1,5 +1,5 @@
 from enum import IntEnum
-from typing import Any, Union, Optional, Dict, Mapping
+from typing import Any, Union, Optional, Dict, Mapping, Sequence, Iterable
 
 class CompressionType(IntEnum):
     NO_COMPRESSION: int
@@ -24,6 +24,199 @@ class EncodingType(IntEnum):
     kPlain: int
     kPrefix: int
 
+class DataBlockIndexType(IntEnum):
+    kDataBlockBinarySearch: int
+    kDataBlockBinaryAndHash: int
+
+class ChecksumType(IntEnum):
+    kNoChecksum: int
+    kCRC32c: int
+    kxxHash: int
+    kxxHash64: int
+    kXXH3: int
+
+class ReadTier(IntEnum):
+    kReadAllTier: int
+    kBlockCacheTier: int
+    kPersistedTier: int
+    kMemtableTier: int
+
+class IOPriority(IntEnum):
+    IO_LOW: int
+    IO_MID: int
+    IO_HIGH: int
+    IO_USER: int
+    IO_TOTAL: int
+
+class ReadOptions:
+    def __init__(self) -> None: ...
+    verify_checksums: bool
+    fill_cache: bool
+    read_tier: ReadTier
+    async_io: bool
+    optimize_multiget_for_io: bool
+    rate_limiter_priority: IOPriority
+    value_size_soft_limit: int
+    ignore_range_deletions: bool
+    adaptive_readahead: bool
+    deadline: int  # microseconds since the epoch, 0 for none
+    io_timeout: int  # microseconds, 0 for none
+    snapshot: Any  # Snapshot, cSnapshot or None
+    def __copy__(self) -> ReadOptions: ...
+    def to_dict(self) -> dict[str, Any]: ...
+
+class WriteOptions:
+    def __init__(self) -> None: ...
+    sync: bool
+    disableWAL: bool
+    ignore_missing_column_families: bool
+    no_slowdown: bool
+    low_pri: bool
+    memtable_insert_hint_per_batch: bool
+    rate_limiter_priority: IOPriority
+    def __copy__(self) -> WriteOptions: ...
+    def to_dict(self) -> dict[str, Any]: ...
+
+class StatsLevel(IntEnum):
+    kDisableAll: int
+    kExceptTickers: int
+    kExceptHistogramOrTimers: int
+    kExceptTimers: int
+    kExceptDetailedTimers: int
+    kExceptTimeForMutex: int
+    kAll: int
+
+class PerfLevel(IntEnum):
+    kDisable: int
+    kEnableCount: int
+    kEnableTimeExceptForMutex: int
+    kEnableTimeAndCPUTimeExceptForMutex: int
+    kEnableTime: int
+
+class Statistics:
+    def __init__(self) -> None: ...
+    stats_level: StatsLevel
+    def ticker(self, name: str) -> int: ...
+    def reset(self) -> None: ...
+    def to_dict(self) -> dict[str, dict[str, Any]]: ...
+
+def set_perf_level(level: PerfLevel) -> None: ...
+def get_perf_level() -> PerfLevel: ...
+def reset_perf_context() -> None: ...
+def perf_context() -> dict[str, int]: ...
+def iostats_context() -> dict[str, int]: ...
+
+class BackupEngineOptions:
+    def __init__(self, backup_dir: str) -> None: ...
+    backup_dir: str
+    share_table_files: bool
+    sync: bool
+    destroy_old_data: bool
+    backup_log_files: bool
+    backup_rate_limit: int
+    restore_rate_limit: int
+    share_files_with_checksum: bool
+    max_background_operations: int
+    callback_trigger_interval_size: int
+    max_valid_backups_to_open: int
+    def to_dict(self) -> Dict[str, Any]: ...
+
+class Cache:
+    @staticmethod
+    def lru(capacity: int, num_shard_bits: int = -1, strict_capacity_limit: bool = False, high_pri_pool_ratio: float = 0.5) -> Cache: ...
+    @staticmethod
+    def hyper_clock(capacity: int, estimated_entry_charge: int = 0, num_shard_bits: int = -1, strict_capacity_limit: bool = False) -> Cache: ...
+
+    capacity: int
+    strict_capacity_limit: bool
+    @property
+    def usage(self) -> int: ...
+    @property
+    def pinned_usage(self) -> int: ...
+
+    def to_dict(self) -> dict[str, Union[int, bool, str]]: ...
+
+class FilterPolicy:
+    @staticmethod
+    def bloom(bits_per_key: float = 10.0) -> FilterPolicy: ...
+    @staticmethod
+    def ribbon(bloom_equivalent_bits_per_key: float = 10.0, bloom_before_level: int = 0) -> FilterPolicy: ...
+    @property
+    def name(self) -> str: ...
+
+class MergeOperator:
+    @staticmethod
+    def uint64_add() -> MergeOperator: ...
+    @staticmethod
+    def max() -> MergeOperator: ...
+    @staticmethod
+    def min() -> MergeOperator: ...
+    @staticmethod
+    def string_append(delimiter: str = ",") -> MergeOperator: ...
+    @staticmethod
+    def bytes_or() -> MergeOperator: ...
+    @property
+    def name(self) -> str: ...
+
+class CompactionFilter:
+    @staticmethod
+    def drop_prefixes(prefixes: Sequence[bytes]) -> CompactionFilter: ...
+    @staticmethod
+    def expiry(offset: int = 0, width: int = 8, big_endian: bool = True, milliseconds: bool = False,
+               env: Optional[Env] = None) -> CompactionFilter: ...
+    @staticmethod
+    def keep_latest_versions(n: int, prefix_len: int, key_prefix: bytes = b"") -> CompactionFilter: ...
+    @property
+    def name(self) -> str: ...
+    @property
+    def processed(self) -> int: ...
+    @property
+    def dropped(self) -> int: ...
+    def reset_counters(self) -> None: ...
+
+class PrefixExtractor:
+    @staticmethod
+    def fixed(prefix_len: int) -> PrefixExtractor: ...
+    @staticmethod
+    def capped(cap_len: int) -> PrefixExtractor: ...
+    @property
+    def name(self) -> str: ...
+
+class BlockBasedTableOptions:
+    def __init__(self) -> None: ...
+
+    cache_index_and_filter_blocks: bool
+    cache_index_and_filter_blocks_with_high_priority: bool
+    pin_l0_filter_and_index_blocks_in_cache: bool
+    pin_top_level_index_and_filter: bool
+    data_block_index_type: DataBlockIndexType
+    data_block_hash_table_util_ratio: float
+    checksum: ChecksumType
+    no_block_cache: bool
+    block_cache: Optional[Cache]
+    block_size: int
+    block_size_deviation: int
+    block_restart_interval: int
+    index_block_restart_interval: int
+    metadata_block_size: int
+    partition_filters: bool
+    decouple_partitioned_filters: bool
+    optimize_filters_for_memory: bool
+    use_delta_encoding: bool
+    filter_policy: Optional[FilterPolicy]
+    whole_key_filtering: bool
+    detect_filter_construct_corruption: bool
+    verify_compression: bool
+    read_amp_bytes_per_bit: int
+    format_version: int
+    enable_index_compression: bool
+    block_align: bool
+    max_auto_readahead_size: int
+    initial_auto_readahead_size: int
+    num_file_reads_for_auto_readahead: int
+
+    def to_dict(self) -> dict[str, Union[int, bool, str, None]]: ...
+
 class cCFHandle:
     pass
 
@@ -36,6 +229,40 @@ class DbOpenRW(DbOpenBase):
 class DbOpenRO(DbOpenBase):
     def __init__(self) -> None: ...
 
+class DbOpenTTL(DbOpenBase):
+    def __init__(self, ttl: int = 0, read_only: bool = False, ttls: Mapping[str, int] = {}) -> None: ...
+    ttl: int
+    read_only: bool
+    ttls: dict[str, int]
+
+class DbOpenSecondary(DbOpenBase):
+    def __init__(self, secondary_path: str, catch_up_interval_ms: int = 0) -> None: ...
+    secondary_path: str
+    catch_up_interval_ms: int
+
+class DbOpenOptimisticTransaction(DbOpenBase):
+    def __init__(self) -> None: ...
+
+class DbOpenTransaction(DbOpenBase):
+    def __init__(self, transaction_lock_timeout: int = 1000, default_lock_timeout: int = 1000, num_stripes: int = 16,
+                 max_num_locks: int = -1) -> None: ...
+    transaction_lock_timeout: int
+    default_lock_timeout: int
+    num_stripes: int
+    max_num_locks: int
+
+class Env:
+    @staticmethod
+    def default() -> Env: ...
+    @property
+    def name(self) -> str: ...
+
+class MockTimeEnv(Env):
+    def __init__(self) -> None: ...
+    def advance(self, seconds: int) -> None: ...
+    @property
+    def offset(self) -> int: ...
+
 class CompactRangeOptions:
     def __init__(self) -> None: ...
 
@@ -67,10 +294,29 @@ class PlainTableOptions:
 
     def to_dict(self) -> dict[str, Union[int, bool, str]]: ...
 
+class IteratorOptions:
+    def __init__(self) -> None: ...
+
+    lower_bound: Optional[bytes]
+    upper_bound: Optional[bytes]
+    # None leaves the value of the call's ReadOptions (or RocksDB's default)
+    prefix_same_as_start: Optional[bool]
+    total_order_seek: Optional[bool]
+    readahead_size: Optional[int]
+    fill_cache: Optional[bool]
+    auto_readahead_size: Optional[bool]
+    pin_data: Optional[bool]
+
+    def __copy__(self) -> 'IteratorOptions': ...
+    def to_dict(self) -> dict[str, Union[int, bool, bytes, None]]: ...
+
 class cCFOptions:
     def __init__(self) -> None: ...
     def optimize_level_style_compaction(self, memtable_memory_budget: int = 512 * 1024 * 1024) -> None: ...
     def optimize_for_small_db(self) -> None: ...
+    def prepare_for_bulk_load(self) -> None: ...
+    def set_plain_table(self, pto: PlainTableOptions) -> None: ...
+    def set_block_based_table(self, bbto: BlockBasedTableOptions) -> None: ...
 
     enable_blob_files: bool
     min_blob_size: int
@@ -82,17 +328,35 @@ class cCFOptions:
     write_buffer_size: int
     level0_file_num_compaction_trigger: int
     max_bytes_for_level_base: int
+    level0_slowdown_writes_trigger: int
+    level0_stop_writes_trigger: int
+    soft_pending_compaction_bytes_limit: int
+    hard_pending_compaction_bytes_limit: int
+    max_compaction_bytes: int
+    max_write_buffer_number: int
+    target_file_size_base: int
+    num_levels: int
     disable_auto_compactions: bool
+    prefix_extractor: Optional[PrefixExtractor]
+    merge_operator: Optional[MergeOperator]
+    compaction_filter: Optional[CompactionFilter]
+    memtable_prefix_bloom_size_ratio: float
+    memtable_whole_key_filtering: bool
+    optimize_filters_for_hits: bool
 
     def to_dict(self) -> dict[str, Union[int, bool, str]]: ...
 
 class cDBOptions:
     def __init__(self) -> None: ...
     def increase_parallelism(self, total_threads: int) -> None: ...
+    def prepare_for_bulk_load(self) -> None: ...
 
     # Configuration properties
     create_if_missing: bool
     create_missing_column_families: bool
+    row_cache: Optional[Cache]
+    statistics: Optional[Statistics]
+    env: Env  # set None for Env.default()
     error_if_exists: bool
     paranoid_checks: bool
     flush_verify_memtable_count: bool
@@ -188,17 +452,51 @@ class cDB:
     @staticmethod
     def open(path: str, db_options: cDBOptions, column_families : cCFOptions | Mapping[str, cCFOptions], open_type : DbOpenBase) -> 'cDB': ...
     def get_column_family(self, name: str) -> cCFHandle: ...
-    def put(self, cfh: cCFHandle, key: bytes, value: bytes) -> None: ...
-    def get(self, cfh: cCFHandle, key: bytes) -> bytes: ...
-    def delete(self, cfh: cCFHandle, key: bytes) -> None: ...
-    def write(self, batch: cWriteBatch) -> None: ...
-    def create_iterator(self, cfh : cCFHandle) -> cIterator: ...
-    def create_snapshot(self) -> Any: ...
-    def release_snapshot(self, snapshot: Any) -> None: ...
-    def compact_range(self, compact_range_options: CompactRangeOptions, from_key: Optional[bytes], to_key: Optional[bytes]) -> None: ...
+    def put(self, cfh: cCFHandle, key: bytes, value: bytes, write_options: Optional[WriteOptions] = None) -> None: ...
+    def get(self, cfh: cCFHandle, key: bytes, snapshot: Optional[cSnapshot] = None, read_options: Optional[ReadOptions] = None) -> bytes: ...
+    def get_pinned(self, cfh: cCFHandle, key: bytes, snapshot: Optional[cSnapshot] = None, read_options: Optional[ReadOptions] = None) -> Optional[PinnedValue]: ...
+    def multi_get(self, cfh: cCFHandle, keys: Sequence[bytes], snapshot: Optional[cSnapshot] = None, read_options: Optional[ReadOptions] = None) -> list[bytes | None]: ...
+    def multi_get_cf(self, cfhs: Sequence[cCFHandle], keys: Sequence[bytes], snapshot: Optional[cSnapshot] = None, read_options: Optional[ReadOptions] = None) -> list[bytes | None]: ...
+    def merge(self, cfh: cCFHandle, key: bytes, value: bytes, write_options: Optional[WriteOptions] = None) -> None: ...
+    def delete(self, cfh: cCFHandle, key: bytes, write_options: Optional[WriteOptions] = None) -> None: ...
+    def delete_range(self, cfh: cCFHandle, begin: bytes, end: bytes, write_options: Optional[WriteOptions] = None) -> None: ...
+    def delete_files_in_range(self, cfh: cCFHandle, begin: Optional[bytes], end: Optional[bytes], include_end: bool = False) -> None: ...
+    def write(self, batch: cWriteBatch, write_options: Optional[WriteOptions] = None) -> None: ...
+    def create_iterator(self, cfh : cCFHandle, options : IteratorOptions = ..., snapshot : Optional[cSnapshot] = None, read_options : Optional[ReadOptions] = None) -> cIterator: ...
+    def set_ttl(self, cfh: cCFHandle, ttl: int) -> None: ...
+    def try_catch_up_with_primary(self) -> None: ...
+    def start_catch_up(self, interval_ms: int) -> None: ...
+    def stop_catch_up(self) -> None: ...
+    def create_checkpoint(self, checkpoint_dir: str, log_size_for_flush: int = 0) -> None: ...
+    def create_snapshot(self) -> cSnapshot: ...
+    def release_snapshot(self, snapshot: cSnapshot) -> None: ...
+    def begin_transaction(self, write_options: Optional[WriteOptions] = None, set_snapshot: bool = False,
+                          lock_timeout_ms: int = -1) -> cTransaction: ...
+    def ingest_external_file(self, paths: Sequence[str], cfh: cCFHandle, move_files: bool = False, snapshot_consistency: bool = True,
+                             allow_global_seqno: bool = True, ingest_behind: bool = False) -> None: ...
+    def compact_range(self, compact_range_options: CompactRangeOptions, from_key: Optional[bytes], to_key: Optional[bytes],
+                      cfh: Optional[cCFHandle] = None) -> None: ...
+    def flush(self, cfhs: Optional[Sequence[cCFHandle]] = None, wait: bool = True, allow_write_stall: bool = False) -> None: ...
+    def flush_wal(self, sync: bool = False) -> None: ...
+    def wait_for_compact(self, flush: bool = False, abort_on_pause: bool = False, timeout_ms: int = 0) -> bool: ...
+    def pause_background_work(self) -> None: ...
+    def continue_background_work(self) -> None: ...
+    def enable_auto_compaction(self, cfhs: Optional[Sequence[cCFHandle]] = None) -> None: ...
     def close(self) -> None: ...
 
     def list_column_families(self) -> dict: ...
+    def create_column_family(self, name: str, options: cCFOptions) -> cCFHandle: ...
+    def create_column_families(self, column_families: Mapping[str, cCFOptions]) -> dict[str, cCFHandle]: ...
+    def drop_column_family(self, cfh: cCFHandle) -> None: ...
+    def set_options(self, cfh: cCFHandle, options: Mapping[str, Union[int, float, bool, str]]) -> None: ...
+    def set_db_options(self, options: Mapping[str, Union[int, float, bool, str]]) -> None: ...
+    def get_options(self, cfh: cCFHandle) -> cCFOptions: ...
+    def get_db_options(self) -> cDBOptions: ...
+    def get_option_strings(self, cfh: cCFHandle) -> dict[str, str]: ...
+    def get_db_option_strings(self) -> dict[str, str]: ...
+    def get_property(self, name: str, cfh: Optional[cCFHandle] = None) -> Optional[str]: ...
+    def get_int_property(self, name: str, cfh: Optional[cCFHandle] = None) -> Optional[int]: ...
+    def get_map_property(self, name: str, cfh: Optional[cCFHandle] = None) -> Optional[dict[str, str]]: ...
     @staticmethod
     def get_column_families(dbname: str) -> list[str]: ...
 
@@ -211,10 +509,140 @@ class cIterator:
     def prev(self) -> None: ...
     def key(self) -> bytes: ...
     def value(self) -> bytes: ...
+    def value_view(self) -> PinnedValue: ...
+    def next_batch(self, n: int, max_bytes: int = 0, reverse: bool = False) -> list[tuple[bytes, bytes]]: ...
+    def next_columnar(self, n: int, max_bytes: int = 0, reverse: bool = False, key_width: int = 0,
+                      signed_keys: bool = False) -> cColumnarBatch: ...
+    def close(self) -> None: ...
 
-class cWriteBatch:
-    def __init__(self) -> None: ...
+class PinnedValue:
+    def __len__(self) -> int: ...
+    def __bytes__(self) -> bytes: ...
+    def __buffer__(self, flags: int) -> memoryview: ...
+
+class ColumnBuffer:
+    def __len__(self) -> int: ...
+    def __buffer__(self, flags: int) -> memoryview: ...
+
+class cColumnarBatch:
+    def __len__(self) -> int: ...
+    @property
+    def has_int_keys(self) -> bool: ...
+    @property
+    def key_data(self) -> ColumnBuffer: ...
+    @property
+    def key_offsets(self) -> ColumnBuffer: ...
+    @property
+    def value_data(self) -> ColumnBuffer: ...
+    @property
+    def value_offsets(self) -> ColumnBuffer: ...
+    @property
+    def int_keys(self) -> ColumnBuffer: ...
+
+class cSstFileWriter:
+    def __init__(self, db_options: cDBOptions, cf_options: cCFOptions) -> None: ...
+    def open(self, path: str) -> None: ...
+    def put(self, key: bytes, value: bytes) -> None: ...
+    def delete(self, key: bytes) -> None: ...
+    def put_many(self, items: Sequence[tuple[bytes, bytes]]) -> None: ...
+    def finish(self) -> dict[str, Any]: ...
+    def file_size(self) -> int: ...
+
+def write_sst_files(db_options: cDBOptions, cf_options: cCFOptions, directory: str, prefix: str,
+                    items: Iterable[tuple[bytes, bytes]], partitions: int, threads: int = 0,
+                    memory_limit: int = ...) -> list[dict[str, Any]]: ...
+
+class cSnapshot:
+    def release(self) -> None: ...
+    @property
+    def valid(self) -> bool: ...
+    @property
+    def sequence_number(self) -> int: ...
+
+class TransactionConflict(RuntimeError): ...
+
+class cTransaction:
     def put(self, cfh: cCFHandle, key: bytes, value: bytes) -> None: ...
     def delete(self, cfh: cCFHandle, key: bytes) -> None: ...
+    def merge(self, cfh: cCFHandle, key: bytes, value: bytes) -> None: ...
+    def get(self, cfh: cCFHandle, key: bytes, read_options: Optional[ReadOptions] = None) -> Optional[bytes]: ...
+    def get_for_update(self, cfh: cCFHandle, key: bytes, exclusive: bool = True,
+                       read_options: Optional[ReadOptions] = None) -> Optional[bytes]: ...
+    def set_savepoint(self) -> None: ...
+    def rollback_to_savepoint(self) -> None: ...
+    def pop_savepoint(self) -> None: ...
+    def set_snapshot(self) -> None: ...
+    @property
+    def has_snapshot(self) -> bool: ...
+    def commit(self) -> None: ...
+    def rollback(self) -> None: ...
+    @property
+    def valid(self) -> bool: ...
+
+class cAsyncExecutor:
+    def __init__(self, db: cDB, threads: int = 4) -> None: ...
+    def fileno(self) -> int: ...
+    def submit_get(self, cfh: cCFHandle, key: bytes, snapshot: Optional[cSnapshot] = None,
+                   read_options: Optional[ReadOptions] = None) -> int: ...
+    def submit_multi_get(self, cfh: cCFHandle, keys: Sequence[bytes], snapshot: Optional[cSnapshot] = None,
+                         read_options: Optional[ReadOptions] = None) -> int: ...
+    def submit_put(self, cfh: cCFHandle, key: bytes, value: bytes, write_options: Optional[WriteOptions] = None) -> int: ...
+    def submit_write(self, batch: cWriteBatch, write_options: Optional[WriteOptions] = None) -> int: ...
+    def submit_next_batch(self, iterator: cIterator, n: int, max_bytes: int = 0, reverse: bool = False,
+                          reposition: bool = False) -> int: ...
+    def drain(self) -> list[tuple[int, Any, Optional[str]]]: ...
+    def close(self) -> None: ...
+
+class cParallelScan:
+    def __init__(self, db: cDB, cfh: cCFHandle, begin: Optional[bytes] = None, end: Optional[bytes] = None, partitions: int = 16,
+                 threads: int = 4, snapshot: Optional[cSnapshot] = None, read_options: Optional[ReadOptions] = None,
+                 batch_size: int = 1024, max_bytes: int = 1048576, ordered: bool = True, max_pending: int = 4) -> None: ...
+    def partitions(self) -> list[tuple[Optional[bytes], Optional[bytes]]]: ...
+    def next_chunk(self) -> Optional[list[tuple[bytes, bytes]]]: ...
+    def aggregate(self) -> dict[str, Any]: ...
+    def close(self) -> None: ...
+
+class cGroupCommitWriter:
+    def __init__(self, db: cDB, write_options: Optional[WriteOptions] = None, max_bytes: int = 1048576, max_count: int = 1024,
+                 max_delay_us: int = 1000) -> None: ...
+    def put(self, cfh: cCFHandle, key: bytes, value: bytes, wait: bool = True) -> None: ...
+    def merge(self, cfh: cCFHandle, key: bytes, value: bytes, wait: bool = True) -> None: ...
+    def delete(self, cfh: cCFHandle, key: bytes, wait: bool = True) -> None: ...
+    def flush(self) -> None: ...
+    def close(self) -> None: ...
+    @property
+    def batches_written(self) -> int: ...
+    @property
+    def operations_written(self) -> int: ...
+
+class cBackupEngine:
+    @staticmethod
+    def open(options: BackupEngineOptions) -> cBackupEngine: ...
+    def create_new_backup(self, db: cDB, flush_before_backup: bool = False, app_metadata: str = "",
+                          progress: Optional[Any] = None) -> int: ...
+    def get_backup_info(self) -> list[Dict[str, Any]]: ...
+    def verify_backup(self, backup_id: int, verify_with_checksum: bool = False) -> None: ...
+    def restore_db_from_backup(self, backup_id: int, db_dir: str, wal_dir: str, keep_log_files: bool = False) -> None: ...
+    def purge_old_backups(self, num_backups_to_keep: int) -> None: ...
+    def delete_backup(self, backup_id: int) -> None: ...
+    def garbage_collect(self) -> None: ...
+    def close(self) -> None: ...
+
+# bytes or any object exporting a C-contiguous buffer, e.g. a numpy array
+BytesLike = Union[bytes, bytearray, memoryview, str]
+
+class cWriteBatch:
+    def __init__(self) -> None: ...
+    @staticmethod
+    def from_data(data: bytes) -> cWriteBatch: ...
+    def put(self, cfh: cCFHandle, key: BytesLike, value: BytesLike) -> None: ...
+    def merge(self, cfh: cCFHandle, key: BytesLike, value: BytesLike) -> None: ...
+    def delete(self, cfh: cCFHandle, key: BytesLike) -> None: ...
+    def delete_range(self, cfh: cCFHandle, begin: BytesLike, end: BytesLike) -> None: ...
+    def put_many(self, cfh: cCFHandle, keys: Sequence[BytesLike], values: Sequence[BytesLike]) -> None: ...
+    def put_packed(self, cfh: cCFHandle, key_buffer: BytesLike, key_offsets: Any, value_buffer: BytesLike,
+                   value_offsets: Any) -> None: ...
     def clear(self) -> None: ...
-    def count(self) -> int: ...
\ No newline at end of file
+    def count(self) -> int: ...
+    def data_size(self) -> int: ...
+    def data(self) -> bytes: ...
\ No newline at end of file
@@ -0,0 +1,163 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cAsyncExecutor, cCFHandle, IteratorOptions, ReadOptions, WriteOptions # type: ignore
+from .db import RocksDB
+from .batch import WriteBatch
+from .snapshot import Snapshot, _handle
+from typing import Optional, Any, Sequence, AsyncIterator
+import asyncio
+import copy
+
+def _snapshot_of(read_options : Optional[ReadOptions]) -> Any:
+    # The snapshot set on read_options, kept until the request completes
+    return read_options.snapshot if read_options is not None else None
+
+class AsyncRocksDB:
+    """
+    asyncio front end of an open RocksDB.
+    
+    Requests run on a pool of native threads and never block the event loop.
+    Finished requests are collected in bulk: the pool signals one file
+    descriptor watched with loop.add_reader(), and a single callback resolves
+    every future that completed since the last wakeup. This needs a selector
+    based event loop (the default everywhere but on Windows).
+    
+    The wrapped RocksDB stays usable and must stay open while requests are
+    pending. The facade is bound to the event loop it is first used from.
+    
+    Example:
+        async with AsyncRocksDB(db) as adb:
+            value = await adb.get(cfh, b"key")
+            async for key, value in adb.range(cfh, b"a", b"b"):
+                ...
+    """
+    
+    batch_size : int = 256
+    batch_bytes : int = 1024 * 1024
+    
+    def __init__(self, db : RocksDB, threads : int = 4) -> None:
+        """
+        Start the worker threads.
+        
+        Args:
+            db (RocksDB): Open database to run requests against
+            threads (int): Number of native worker threads
+        """
+        self._db = db
+        self._executor = cAsyncExecutor(db._db, threads)
+        self._loop : Optional[asyncio.AbstractEventLoop] = None
+        # request id -> (future, objects the native request uses)
+        self._pending : dict[int, tuple[asyncio.Future, Any]] = {}
+    
+    def _submit(self, request_id : int, keep_alive : Any = None) -> asyncio.Future:
+        future = self._loop.create_future()
+        self._pending[request_id] = (future, keep_alive)
+        return future
+    
+    def _bind_loop(self) -> None:
+        if self._executor is None:
+            raise RuntimeError("AsyncRocksDB is closed")
+        loop = asyncio.get_running_loop()
+        if self._loop is None:
+            loop.add_reader(self._executor.fileno(), self._on_ready)
+            self._loop = loop
+        elif self._loop is not loop:
+            raise RuntimeError("AsyncRocksDB is bound to a different event loop")
+    
+    def _on_ready(self) -> None:
+        for request_id, result, error in self._executor.drain():
+            future, _ = self._pending.pop(request_id)
+            if future.cancelled():
+                continue
+            if error is None:
+                future.set_result(result)
+            else:
+                future.set_exception(RuntimeError(error))
+    
+    async def get(self, cfh : cCFHandle, key : bytes, snapshot : Optional[Snapshot] = None, read_options : Optional[ReadOptions] = None) -> bytes | None:
+        """
+        Retrieve a value by key, see RocksDB.get.
+        
+        Returns:
+            bytes | None: The value, or None if the key doesn't exist
+        """
+        self._bind_loop()
+        return await self._submit(self._executor.submit_get(cfh, key, _handle(snapshot), read_options), (snapshot, _snapshot_of(read_options)))
+    
+    async def multi_get(self, cfh : cCFHandle, keys : Sequence[bytes], snapshot : Optional[Snapshot] = None, read_options : Optional[ReadOptions] = None) -> list[bytes | None]:
+        """
+        Retrieve several values in one request, see RocksDB.multi_get.
+        
+        Returns:
+            list: Values in the order of `keys`, None for missing keys
+        """
+        self._bind_loop()
+        return await self._submit(self._executor.submit_multi_get(cfh, keys, _handle(snapshot), read_options), (snapshot, _snapshot_of(read_options)))
+    
+    async def put(self, cfh : cCFHandle, key : bytes, value : bytes, write_options : Optional[WriteOptions] = None) -> None:
+        """Store a key-value pair, see RocksDB.put."""
+        self._bind_loop()
+        await self._submit(self._executor.submit_put(cfh, key, value, write_options))
+    
+    async def write(self, batch : WriteBatch, write_options : Optional[WriteOptions] = None) -> None:
+        """
+        Apply a batch atomically, see RocksDB.write. The batch is copied when
+        the request is made and can be reused right away.
+        """
+        self._bind_loop()
+        await self._submit(self._executor.submit_write(batch._batch, write_options))
+    
+    async def range(self, 
+                    cfh : cCFHandle, 
+                    start : Optional[bytes], 
+                    end : Optional[bytes], 
+                    reverse : bool = False, 
+                    options : Optional[IteratorOptions] = None,
+                    snapshot : Optional[Snapshot] = None,
+                    read_options : Optional[ReadOptions] = None
+                    ) -> AsyncIterator[tuple[bytes, bytes]]:
+        """
+        Iterate over the key-value pairs in [start, end) with `async for`,
+        see RocksDB.range.
+        
+        Rows are read by the worker threads in chunks of up to `batch_size`
+        rows / `batch_bytes` bytes; the event loop only runs while a chunk is
+        fetched.
+        """
+        self._bind_loop()
+        options = copy.copy(options) if options is not None else IteratorOptions()
+        options.lower_bound = start
+        options.upper_bound = end
+
+        it = self._db.iterator(cfh, options, snapshot, read_options)
+        try:
+            reposition = True
+            while True:
+                request_id = self._executor.submit_next_batch(it._iter, self.batch_size, self.batch_bytes, reverse, reposition)
+                chunk = await self._submit(request_id, (it, snapshot))
+                reposition = False
+                if not chunk:
+                    return
+                for row in chunk:
+                    yield row
+        finally:
+            it.close()
+    
+    def close(self) -> None:
+        """
+        Stop the worker threads. Requests still queued fail with RuntimeError;
+        the database itself is left open.
+        """
+        if self._executor is None:
+            return
+        self._executor.close()
+        if self._loop is not None:
+            self._loop.remove_reader(self._executor.fileno())
+            if not self._loop.is_closed():
+                self._on_ready()
+        self._executor = None
+    
+    async def __aenter__(self) -> AsyncRocksDB:
+        return self
+    
+    async def __aexit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        self.close()
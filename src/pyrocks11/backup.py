@@ -0,0 +1,112 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cBackupEngine, BackupEngineOptions # type: ignore
+from .db import RocksDB
+from typing import Optional, Any, Callable
+
+class BackupEngine:
+    """
+    Incremental backups of live databases.
+    
+    Each backup only copies the SST files that are not in the backup
+    directory yet, so taking backups regularly is cheap. Files are copied by
+    `max_background_operations` threads, at up to `backup_rate_limit` /
+    `restore_rate_limit` bytes per second (0 for unlimited), without holding
+    the GIL; the database stays writable meanwhile.
+    
+    Example:
+        with BackupEngine.open("/backups/db") as engine:
+            engine.create_backup(db)
+            engine.restore("/restore/db")
+    """
+    
+    @classmethod
+    def open(cls, options : str | BackupEngineOptions) -> BackupEngine:
+        """
+        Open or create a backup directory.
+        
+        Args:
+            options (str | BackupEngineOptions): Backup directory, or options naming it
+        
+        Returns:
+            BackupEngine: Backup engine
+        """
+        if isinstance(options, str):
+            options = BackupEngineOptions(options)
+        return cls(cBackupEngine.open(options))
+    
+    def __init__(self, engine : cBackupEngine) -> None:
+        self._engine = engine
+    
+    def create_backup(self, 
+                      db : RocksDB, 
+                      flush_before_backup : bool = False, 
+                      app_metadata : str = "", 
+                      progress : Optional[Callable[[int], Any]] = None
+                      ) -> int:
+        """
+        Back up the current state of a database.
+        
+        Args:
+            db (RocksDB): Database to back up
+            flush_before_backup (bool): Flush the memtables first instead of copying the WAL
+            app_metadata (str): Stored with the backup, see backups()
+            progress (callable, optional): Called from this thread with the approximate
+                number of bytes copied so far, every callback_trigger_interval_size bytes
+        
+        Returns:
+            int: Id of the new backup
+        """
+        return self._engine.create_new_backup(db._db, flush_before_backup, app_metadata, progress)
+    
+    def backups(self) -> list[dict[str, Any]]:
+        """
+        List the backups.
+        
+        Returns:
+            list: One dict per backup with backup_id, timestamp, size, number_files and app_metadata
+        """
+        return self._engine.get_backup_info()
+    
+    def verify(self, backup_id : int, verify_with_checksum : bool = False) -> None:
+        """
+        Check that the files of a backup exist with the expected sizes, and
+        with `verify_with_checksum` also their checksums.
+        
+        Raises:
+            RuntimeError: If the backup is damaged
+        """
+        self._engine.verify_backup(backup_id, verify_with_checksum)
+    
+    def restore(self, db_dir : str, backup_id : Optional[int] = None, wal_dir : Optional[str] = None, keep_log_files : bool = False) -> None:
+        """
+        Restore a backup into a directory. The database there must not be open.
+        
+        Args:
+            db_dir (str): Directory to restore into
+            backup_id (int, optional): Backup to restore, None for the latest
+            wal_dir (str, optional): WAL directory, None for db_dir
+            keep_log_files (bool): Keep WAL files already in wal_dir and replay them after the backup
+        """
+        self._engine.restore_db_from_backup(backup_id or 0, db_dir, wal_dir or db_dir, keep_log_files)
+    
+    def purge_old_backups(self, num_backups_to_keep : int) -> None:
+        """Delete all but the newest `num_backups_to_keep` backups."""
+        self._engine.purge_old_backups(num_backups_to_keep)
+    
+    def delete_backup(self, backup_id : int) -> None:
+        """Delete one backup."""
+        self._engine.delete_backup(backup_id)
+    
+    def garbage_collect(self) -> None:
+        """Remove files left behind by interrupted backups and deletions."""
+        self._engine.garbage_collect()
+    
+    def close(self) -> None:
+        """Close the backup engine."""
+        self._engine.close()
+    
+    def __enter__(self) -> BackupEngine:
+        return self
+    
+    def __exit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        self.close()
@@ -1,16 +1,45 @@
+from __future__ import annotations
 from ._rocksdb_cpp import cWriteBatch, cCFHandle  # type: ignore
+from typing import Any, Sequence, Union
+
+# bytes or any object exporting a C-contiguous buffer: bytearray, memoryview,
+# numpy arrays, ...; str is written UTF-8 encoded
+BytesLike = Union[bytes, bytearray, memoryview, str]
+
 class WriteBatch:
     """
     A batch of write operations.
     
     This class provides a way to atomically apply multiple updates to a database.
+    
+    Keys and values can be bytes or any object supporting the buffer protocol
+    (bytearray, memoryview, numpy arrays, ...); their bytes are copied
+    straight into the batch without an intermediate bytes object. str is
+    accepted too and written UTF-8 encoded.
     """
     
     def __init__(self) -> None:
         """Initialize an empty write batch."""
         self._batch = cWriteBatch()
     
-    def put(self, cfh: cCFHandle, key : bytes, value : bytes) -> None:
+    @classmethod
+    def from_data(cls, data : bytes) -> WriteBatch:
+        """
+        Rebuild a batch from the output of data(), e.g. one received from
+        another process. Column families are referred to by id, so it must be
+        written to a database with the same column families.
+        
+        Args:
+            data (bytes): Serialized batch
+        
+        Returns:
+            WriteBatch: Batch with the serialized operations
+        """
+        batch = cls.__new__(cls)
+        batch._batch = cWriteBatch.from_data(data)
+        return batch
+    
+    def put(self, cfh: cCFHandle, key : BytesLike, value : BytesLike) -> None:
         """
         Add a put operation to the batch.
         
@@ -24,7 +53,45 @@ class WriteBatch:
         self._batch.put(cfh, key, value)
         return None
     
-    def delete(self, cfh: cCFHandle, key: bytes) -> None:
+    def put_many(self, cfh: cCFHandle, keys : Sequence[BytesLike], values : Sequence[BytesLike]) -> None:
+        """
+        Add a put operation for each key/value pair in one call.
+        
+        Args:
+            keys (Sequence): Keys to put
+            values (Sequence): Values to put, one per key
+        """
+        self._batch.put_many(cfh, keys, values)
+    
+    def put_packed(self, cfh: cCFHandle, key_buffer : BytesLike, key_offsets : Any, value_buffer : BytesLike, value_offsets : Any) -> None:
+        """
+        Add puts for records packed into two buffers, in one native call.
+        
+        Record i is key_buffer[key_offsets[i]:key_offsets[i + 1]] with value
+        value_buffer[value_offsets[i]:value_offsets[i + 1]], the layout of
+        Arrow binary arrays.
+        
+        Args:
+            key_buffer: All keys back to back
+            key_offsets: 1-d buffer of int32/int64 offsets in native byte order, one more than there are records
+                (e.g. array.array("q", ...) or a numpy array)
+            value_buffer: All values back to back
+            value_offsets: Offsets into value_buffer, same length as key_offsets
+        """
+        self._batch.put_packed(cfh, key_buffer, key_offsets, value_buffer, value_offsets)
+    
+    def merge(self, cfh: cCFHandle, key : BytesLike, value : BytesLike) -> None:
+        """
+        Add a merge operation to the batch. The column family needs a merge operator.
+        
+        Args:
+            key (bytes): Key to merge into
+            value (bytes): Operand for the column family's merge operator
+        """
+        self._batch.merge(cfh, key, value)
+        return None
+    
+    def delete(self, cfh: cCFHandle, key: BytesLike) -> None:
         """
         Add a delete operation to the batch.
         
@@ -37,6 +104,17 @@ class WriteBatch:
         self._batch.delete(cfh, key)
         return None
     
+    def delete_range(self, cfh: cCFHandle, begin: BytesLike, end: BytesLike) -> None:
+        """
+        Add a range deletion of the keys in [begin, end) to the batch.
+        
+        Args:
+            begin (bytes): First key to delete
+            end (bytes): Key after the last one to delete
+        """
+        self._batch.delete_range(cfh, begin, end)
+        return None
+    
     def clear(self) -> None:
         """
         Clear all operations from the batch.
@@ -55,3 +133,16 @@ class WriteBatch:
             int: Number of operations
         """
         return self._batch.count()
+    
+    def data_size(self) -> int:
+        """Size of the serialized batch in bytes."""
+        return self._batch.data_size()
+    
+    def data(self) -> bytes:
+        """
+        Serialize the batch, for WriteBatch.from_data().
+        
+        Returns:
+            bytes: The batch's internal representation
+        """
+        return self._batch.data()
@@ -0,0 +1,106 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cColumnarBatch, ColumnBuffer # type: ignore
+from typing import Any
+
+class ColumnarBatch:
+    """
+    Rows read by DbIterator.next_columnar() in the Arrow large-binary layout.
+    
+    Keys and values are each one contiguous data buffer plus len(batch) + 1
+    int64 offsets, so row i is data[offsets[i]:offsets[i + 1]]. If the keys
+    were decoded as integers (key_width), they are a single int64 buffer
+    instead. The buffers support the buffer protocol and are shared with
+    memoryview, numpy and pyarrow without copying; they stay valid for as
+    long as anything references them.
+    
+    numpy and pyarrow are only imported by to_numpy() and to_arrow().
+    """
+    
+    def __init__(self, batch_handle : cColumnarBatch) -> None:
+        """
+        Initialize the batch.
+        
+        Args:
+            batch_handle: Native batch handle
+        """
+        self._batch = batch_handle
+    
+    def __len__(self) -> int:
+        return len(self._batch)
+    
+    @property
+    def has_int_keys(self) -> bool:
+        """True if keys were decoded into int_keys."""
+        return self._batch.has_int_keys
+    
+    @property
+    def key_data(self) -> ColumnBuffer:
+        """Concatenated keys (uint8), empty if has_int_keys."""
+        return self._batch.key_data
+    
+    @property
+    def key_offsets(self) -> ColumnBuffer:
+        """len(batch) + 1 int64 offsets into key_data."""
+        return self._batch.key_offsets
+    
+    @property
+    def value_data(self) -> ColumnBuffer:
+        """Concatenated values (uint8)."""
+        return self._batch.value_data
+    
+    @property
+    def value_offsets(self) -> ColumnBuffer:
+        """len(batch) + 1 int64 offsets into value_data."""
+        return self._batch.value_offsets
+    
+    @property
+    def int_keys(self) -> ColumnBuffer:
+        """Keys decoded as int64, if has_int_keys."""
+        return self._batch.int_keys
+    
+    def to_numpy(self) -> dict[str, Any]:
+        """
+        Wrap the buffers in read-only numpy arrays without copying.
+        
+        Returns:
+            dict: "key" (int64) if has_int_keys, otherwise "key_data" (uint8) and
+            "key_offsets" (int64); always "value_data" (uint8) and "value_offsets" (int64)
+        """
+        import numpy as np
+        rv = {"value_data": np.frombuffer(self.value_data, dtype=np.uint8),
+              "value_offsets": np.frombuffer(self.value_offsets, dtype=np.int64)}
+        if self.has_int_keys:
+            rv["key"] = np.frombuffer(self.int_keys, dtype=np.int64)
+        else:
+            rv["key_data"] = np.frombuffer(self.key_data, dtype=np.uint8)
+            rv["key_offsets"] = np.frombuffer(self.key_offsets, dtype=np.int64)
+        return rv
+    
+    def to_arrow(self, key_name : str = "key", value_name : str = "value") -> Any:
+        """
+        Wrap the buffers in a pyarrow.RecordBatch without copying.
+        
+        Returns:
+            pyarrow.RecordBatch: Columns `key_name` (large_binary, or int64 if
+            has_int_keys) and `value_name` (large_binary)
+        """
+        import pyarrow as pa
+        n = len(self)
+        values = pa.Array.from_buffers(pa.large_binary(), n, 
+                                       [None, pa.py_buffer(self.value_offsets), pa.py_buffer(self.value_data)])
+        if self.has_int_keys:
+            keys = pa.Array.from_buffers(pa.int64(), n, [None, pa.py_buffer(self.int_keys)])
+        else:
+            keys = pa.Array.from_buffers(pa.large_binary(), n, 
+                                         [None, pa.py_buffer(self.key_offsets), pa.py_buffer(self.key_data)])
+        return pa.RecordBatch.from_arrays([keys, values], names=[key_name, value_name])
+    
+    def to_list(self) -> list[tuple[Any, bytes]]:
+        """(key, value) pairs as next_batch() returns them; keys are ints if has_int_keys."""
+        values, value_offsets = bytes(self.value_data), memoryview(self.value_offsets)
+        if self.has_int_keys:
+            keys = list(memoryview(self.int_keys))
+        else:
+            key_data, key_offsets = bytes(self.key_data), memoryview(self.key_offsets)
+            keys = [key_data[key_offsets[i]:key_offsets[i + 1]] for i in range(len(self))]
+        return [(keys[i], values[value_offsets[i]:value_offsets[i + 1]]) for i in range(len(self))]
@@ -1,9 +1,19 @@
 from __future__ import annotations
-from ._rocksdb_cpp import cDB, cCFHandle, DbOpenBase, DbOpenRW, CompactRangeOptions # type: ignore
+from ._rocksdb_cpp import cDB, cCFHandle, DbOpenBase, DbOpenRW, CompactRangeOptions, IteratorOptions, PinnedValue # type: ignore
+from ._rocksdb_cpp import ReadOptions, WriteOptions, cGroupCommitWriter, cParallelScan # type: ignore
 from .options import DBOptions, CFOptions
 from .iterator import DbIterator
+from .columnar import ColumnarBatch
 from .batch import WriteBatch
-from typing import Optional, Any
+from .snapshot import Snapshot, _handle
+from .transaction import Transaction
+from .group_commit import GroupCommitWriter
+from .parallel_scan import ParallelScan
+from .sst import _write_sst_files_info, DEFAULT_MEMORY_LIMIT
+from typing import Optional, Any, Sequence, Iterator, Iterable
+import contextlib
+import copy
+import os
 import weakref
 
 class RocksDB:
@@ -31,6 +41,10 @@ class RocksDB:
                 - If a cCFOptions object is provided, it will be used as the default column family options.
                 - If a dictionary is provided, keys should be column family names and values should be cCFOptions objects.
                 - If None is provided, default column family options will be used.
+            open_type (DbOpenBase, optional): DbOpenRW (default), DbOpenRO, DbOpenTTL to
+                have values expire and be dropped by compaction, DbOpenSecondary to follow
+                a primary opened by another process, or DbOpenTransaction /
+                DbOpenOptimisticTransaction to use transaction().
             
         Returns:
             DB: Database instance
@@ -64,7 +78,7 @@ class RocksDB:
         """
         return self._db.get_column_family(column_name)
 
-    def put(self, cfh: cCFHandle, key : bytes, value : bytes) -> None:
+    def put(self, cfh: cCFHandle, key : bytes, value : bytes, write_options: Optional[WriteOptions] = None) -> None:
         """
         Store a key-value pair in the database under the specified column family.
         
@@ -72,16 +86,19 @@ class RocksDB:
             cfh (cCFHandle): Column family handle
             key (bytes): The key to store
             value (bytes): The value to store
+            write_options (WriteOptions, optional): WAL, sync and stall settings for this write
         """
-        self._db.put(cfh, key, value)
+        self._db.put(cfh, key, value, write_options)
     
-    def get(self, cfh: cCFHandle, key: bytes ) -> bytes | None:
+    def get(self, cfh: cCFHandle, key: bytes, snapshot: Optional[Snapshot] = None, read_options: Optional[ReadOptions] = None) -> bytes | None:
         """
         Retrieve a value for the given key from the specified column family.
         
         Args:
             cfh (cCFHandle): Column family handle
             key (bytes): The key to retrieve
+            snapshot (Snapshot, optional): Read as of this snapshot instead of the latest state
+            read_options (ReadOptions, optional): Checksum, cache, tier, async IO, deadline and snapshot settings; `snapshot` takes precedence
             
         Returns:
             bytes: The value associated with the key
@@ -89,58 +106,478 @@ class RocksDB:
         Raises:
             KeyError: If the key does not exist in the specified column family
         """
-        return self._db.get(cfh, key)
+        return self._db.get(cfh, key, _handle(snapshot), read_options)
     
-    def delete(self, cfh: cCFHandle, key : bytes) -> None:
+    def get_pinned(self, cfh: cCFHandle, key: bytes, snapshot: Optional[Snapshot] = None, read_options: Optional[ReadOptions] = None) -> PinnedValue | None:
+        """
+        Retrieve a value without copying it out of RocksDB.
+        
+        The returned object supports the buffer protocol, so `memoryview(value)`,
+        `numpy.frombuffer(value, ...)` or `socket.send(value)` read the bytes in place.
+        The block holding the value stays pinned until the object (and every view of it)
+        is garbage collected. A pinned value references the open database, so close()
+        raises RuntimeError until it is released. Values that had to be copied (e.g.
+        merge results) do not count.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            key (bytes): The key to retrieve
+            snapshot (Snapshot, optional): Read as of this snapshot instead of the latest state
+            read_options (ReadOptions, optional): Checksum, cache, tier, async IO, deadline and snapshot settings; `snapshot` takes precedence
+            
+        Returns:
+            PinnedValue: Read-only view of the value, None if the key does not exist
+        """
+        return self._db.get_pinned(cfh, key, _handle(snapshot), read_options)
+    
+    def multi_get(self, cfh: cCFHandle, keys: Sequence[bytes], snapshot: Optional[Snapshot] = None, read_options: Optional[ReadOptions] = None) -> list[bytes | None]:
+        """
+        Retrieve the values for many keys of one column family in a single call.
+        
+        Uses RocksDB's batched MultiGet, which sorts the keys and shares block
+        lookups between them. The GIL is released while the lookups run.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            keys (Sequence[bytes]): The keys to retrieve
+            snapshot (Snapshot, optional): Read as of this snapshot instead of the latest state
+            read_options (ReadOptions, optional): Checksum, cache, tier, async IO, deadline and snapshot settings; `snapshot` takes precedence
+            
+        Returns:
+            list[bytes | None]: The values in the same order as `keys`, None for missing keys
+        """
+        return self._db.multi_get(cfh, keys, _handle(snapshot), read_options)
+    
+    def multi_get_cf(self, cfhs: Sequence[cCFHandle], keys: Sequence[bytes], snapshot: Optional[Snapshot] = None, read_options: Optional[ReadOptions] = None) -> list[bytes | None]:
+        """
+        Retrieve the values for many keys spread over several column families.
+        
+        Args:
+            cfhs (Sequence[cCFHandle]): Column family handle of each key
+            keys (Sequence[bytes]): The keys to retrieve, same length as `cfhs`
+            snapshot (Snapshot, optional): Read as of this snapshot instead of the latest state
+            read_options (ReadOptions, optional): Checksum, cache, tier, async IO, deadline and snapshot settings; `snapshot` takes precedence
+            
+        Returns:
+            list[bytes | None]: The values in the same order as `keys`, None for missing keys
+        """
+        return self._db.multi_get_cf(cfhs, keys, _handle(snapshot), read_options)
+    
+    def merge(self, cfh: cCFHandle, key : bytes, value : bytes, write_options: Optional[WriteOptions] = None) -> None:
+        """
+        Combine a value into a key with the column family's merge operator.
+        
+        This is a blind write: the existing value is not read. The operands are
+        combined natively on reads and during compaction, see MergeOperator.
+        
+        Args:
+            cfh (cCFHandle): Column family handle, its CFOptions.merge_operator must be set
+            key (bytes): The key to merge into
+            value (bytes): The merge operand
+            write_options (WriteOptions, optional): WAL, sync and stall settings for this write
+        """
+        self._db.merge(cfh, key, value, write_options)
+    
+    def delete(self, cfh: cCFHandle, key : bytes, write_options: Optional[WriteOptions] = None) -> None:
         """
         Delete a key-value pair from the specified column family.
         
         Args:
             cfh (cCFHandle): Column family handle
             key (bytes): The key to delete
+            write_options (WriteOptions, optional): WAL, sync and stall settings for this write
+        """
+        self._db.delete(cfh, key, write_options)
+    
+    def delete_range(self, 
+                     cfh: cCFHandle, 
+                     begin: bytes, 
+                     end: bytes, 
+                     write_options: Optional[WriteOptions] = None, 
+                     drop_files: bool = False
+                     ) -> None:
+        """
+        Delete every key in [begin, end) with a single range tombstone.
+        
+        Unlike deleting key by key, this writes one record, and later reads and
+        scans skip the whole range at once instead of stepping over point tombstones.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            begin (bytes): First key to delete
+            end (bytes): Key after the last one to delete
+            write_options (WriteOptions, optional): WAL, sync and stall settings for this write
+            drop_files (bool): First drop the SST files that lie entirely inside the range
+                (see delete_files_in_range), so their space is reclaimed immediately.
+                This is not atomic and ignores snapshots for the dropped data.
+        """
+        if drop_files:
+            self._db.delete_files_in_range(cfh, begin, end, False)
+        self._db.delete_range(cfh, begin, end, write_options)
+    
+    def delete_files_in_range(self, cfh: cCFHandle, begin: Optional[bytes], end: Optional[bytes], include_end: bool = False) -> None:
+        """
+        Drop the SST files whose keys all lie inside the range.
+        
+        No tombstones are written: keys in memtables and in files that only
+        partly overlap the range survive, so this is usually followed by
+        delete_range. Snapshots do not protect the dropped data.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            begin (bytes, optional): Start of the range, None for the first key
+            end (bytes, optional): End of the range, None for past the last key
+            include_end (bool): Treat `end` as part of the range
         """
-        self._db.delete(cfh, key)
+        self._db.delete_files_in_range(cfh, begin, end, include_end)
     
-    def write(self, batch : WriteBatch) -> None:
+    def write(self, batch : WriteBatch, write_options: Optional[WriteOptions] = None) -> None:
         """
         Apply a batch of operations to the database.
         
         Args:
             batch (WriteBatch): Batch of operations to apply
+            write_options (WriteOptions, optional): WAL, sync and stall settings for this write
+        """
+        self._db.write(batch._batch, write_options)
+    
+    def group_commit_writer(self, 
+                            write_options : Optional[WriteOptions] = None, 
+                            max_bytes : int = 1 << 20, 
+                            max_count : int = 1024, 
+                            max_delay_us : int = 1000
+                            ) -> GroupCommitWriter:
+        """
+        Create a writer that coalesces writes from many threads into shared
+        batches, see GroupCommitWriter.
+        
+        Args:
+            write_options (WriteOptions, optional): Options for every batch, e.g. sync
+            max_bytes (int): Write a batch once it holds this much data, 0 for no limit
+            max_count (int): Write a batch once it holds this many operations, 0 for no limit
+            max_delay_us (int): Write a batch at the latest this long after its first operation
+        
+        Returns:
+            GroupCommitWriter: Writer, also usable as a context manager
         """
-        self._db.write(batch._batch)
+        hnd = cGroupCommitWriter(self._db, write_options, max_bytes, max_count, max_delay_us)
+        writer = GroupCommitWriter(hnd)
+        self._fin_set.add(weakref.finalize(writer, self._close_hnd, hnd))
+        return writer
     
-    def iterator(self, cfh : cCFHandle) -> DbIterator:
+    def iterator(self, 
+                 cfh : cCFHandle, 
+                 options : Optional[IteratorOptions] = None, 
+                 snapshot : Optional[Snapshot] = None,
+                 read_options : Optional[ReadOptions] = None
+                 ) -> DbIterator:
         """
         Create an iterator for this database.
         
+        Args:
+            cfh (cCFHandle): Column family handle
+            options (IteratorOptions, optional): Bounds, prefix mode and readahead for the iterator
+            snapshot (Snapshot, optional): Iterate over the state as of this snapshot
+            read_options (ReadOptions, optional): Base read settings; fields set in `options` override them
+        
         Returns:
             DbIterator: Database iterator
         """
-        dbi =  self._db.create_iterator(cfh)
+        if options is None:
+            options = IteratorOptions()
+        dbi =  self._db.create_iterator(cfh, options, _handle(snapshot), read_options)
         dbw = DbIterator(dbi)
         self._fin_set.add(weakref.finalize(dbw, self._close_hnd, dbi))
         return dbw
     
-    def snapshot(self) -> Any:
+    def range(self, 
+              cfh : cCFHandle, 
+              start : Optional[bytes], 
+              end : Optional[bytes], 
+              reverse : bool = False, 
+              options : Optional[IteratorOptions] = None,
+              snapshot : Optional[Snapshot] = None,
+              read_options : Optional[ReadOptions] = None
+              ) -> Iterator[tuple[bytes, bytes]]:
+        """
+        Iterate over the key-value pairs in [start, end).
+        
+        The bounds are passed to RocksDB as iterate_lower_bound/iterate_upper_bound,
+        so SST files and data blocks outside the range are skipped instead of being
+        walked through.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            start (bytes, optional): Inclusive lower bound, None for the first key
+            end (bytes, optional): Exclusive upper bound, None for past the last key
+            reverse (bool): Iterate from the last key in the range to the first
+            options (IteratorOptions, optional): Further iterator options; its bounds are replaced by start/end
+            snapshot (Snapshot, optional): Iterate over the state as of this snapshot
+            read_options (ReadOptions, optional): Base read settings, see iterator()
+            
+        Yields:
+            tuple: (key, value) pairs in key order (reversed if `reverse`)
+        """
+        options = copy.copy(options) if options is not None else IteratorOptions()
+        options.lower_bound = start
+        options.upper_bound = end
+
+        it = self.iterator(cfh, options, snapshot, read_options)
+        try:
+            if reverse:
+                it.seek_to_last()
+            else:
+                it.seek_to_first()
+            while True:
+                chunk = it.next_batch(DbIterator.batch_size, DbIterator.batch_bytes, reverse)
+                if not chunk:
+                    return
+                yield from chunk
+        finally:
+            it.close()
+    
+    def range_columnar(self, 
+                       cfh : cCFHandle, 
+                       start : Optional[bytes], 
+                       end : Optional[bytes], 
+                       batch_size : int = 65536, 
+                       max_bytes : int = 64 << 20,
+                       key_width : int = 0,
+                       signed_keys : bool = False,
+                       options : Optional[IteratorOptions] = None,
+                       snapshot : Optional[Snapshot] = None,
+                       read_options : Optional[ReadOptions] = None
+                       ) -> Iterator[ColumnarBatch]:
+        """
+        Iterate over [start, end) in columnar batches, see DbIterator.next_columnar.
+        
+        For example, to load a range into Arrow:
+            pyarrow.Table.from_batches(b.to_arrow() for b in db.range_columnar(cfh, start, end))
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            start (bytes, optional): Inclusive lower bound, None for the first key
+            end (bytes, optional): Exclusive upper bound, None for past the last key
+            batch_size (int): Maximum rows per batch
+            max_bytes (int): End a batch once its keys and values add up to this many bytes, 0 for no limit
+            key_width (int): If 1-8, decode keys as big-endian integers of this many bytes
+            signed_keys (bool): Sign-extend decoded keys
+            options (IteratorOptions, optional): Further iterator options; its bounds are replaced by start/end
+            snapshot (Snapshot, optional): Iterate over the state as of this snapshot
+            read_options (ReadOptions, optional): Base read settings, see iterator()
+            
+        Yields:
+            ColumnarBatch: Non-empty batches in key order
+        """
+        options = copy.copy(options) if options is not None else IteratorOptions()
+        options.lower_bound = start
+        options.upper_bound = end
+
+        it = self.iterator(cfh, options, snapshot, read_options)
+        try:
+            it.seek_to_first()
+            while True:
+                batch = it.next_columnar(batch_size, max_bytes, False, key_width, signed_keys)
+                if not len(batch):
+                    return
+                yield batch
+        finally:
+            it.close()
+    
+    def parallel_scan(self, 
+                      cfh : cCFHandle, 
+                      start : Optional[bytes] = None, 
+                      end : Optional[bytes] = None, 
+                      threads : Optional[int] = None, 
+                      partitions : Optional[int] = None, 
+                      ordered : bool = True, 
+                      snapshot : Optional[Snapshot] = None,
+                      read_options : Optional[ReadOptions] = None,
+                      batch_size : int = 1024,
+                      max_bytes : int = 1 << 20,
+                      max_pending : int = 4
+                      ) -> ParallelScan:
+        """
+        Scan [start, end) on native worker threads, see ParallelScan.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            start (bytes, optional): Inclusive lower bound, None for the first key
+            end (bytes, optional): Exclusive upper bound, None for past the last key
+            threads (int, optional): Worker threads, the number of CPUs by default
+            partitions (int, optional): Upper limit on the number of partitions, 4 per thread by default.
+                There are at most as many as there are SST file boundaries in the range.
+            ordered (bool): Return rows in key order; otherwise chunks come in the order they are read
+            snapshot (Snapshot, optional): Scan the state as of this snapshot instead of the current one
+            read_options (ReadOptions, optional): Base read settings, e.g. fill_cache=False for one-off scans
+            batch_size (int): Rows per chunk
+            max_bytes (int): End a chunk once it holds this much data, 0 for no limit
+            max_pending (int): Chunks buffered per partition (ordered) or per thread before workers wait
+        
+        Returns:
+            ParallelScan: Scan, also usable as a context manager
+        """
+        if threads is None:
+            threads = os.cpu_count() or 4
+        if partitions is None:
+            partitions = threads * 4
+        hnd = cParallelScan(self._db, cfh, start, end, partitions, threads, _handle(snapshot), read_options, 
+                            batch_size, max_bytes, ordered, max_pending)
+        scan = ParallelScan(hnd)
+        self._fin_set.add(weakref.finalize(scan, self._close_hnd, hnd))
+        return scan
+    
+    def try_catch_up_with_primary(self) -> None:
+        """
+        Make the writes of the primary visible to a database opened with
+        DbOpenSecondary, by replaying its new MANIFEST and WAL entries.
+        """
+        self._db.try_catch_up_with_primary()
+    
+    def start_catch_up(self, interval_ms: int) -> None:
+        """
+        Catch up with the primary every `interval_ms` milliseconds on a native
+        background thread, until stop_catch_up() or close(). Replaces any
+        running catch-up thread.
+        """
+        self._db.start_catch_up(interval_ms)
+    
+    def stop_catch_up(self) -> None:
+        """Stop the background catch-up thread, if any."""
+        self._db.stop_catch_up()
+    
+    def set_ttl(self, cfh: cCFHandle, ttl: int) -> None:
+        """
+        Change the TTL of a column family of a database opened with DbOpenTTL.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            ttl (int): New TTL in seconds, 0 or less to never expire
+        """
+        self._db.set_ttl(cfh, ttl)
+    
+    def create_checkpoint(self, checkpoint_dir : str, log_size_for_flush : int = 0) -> None:
+        """
+        Create a consistent copy of the open database that can be opened like
+        any other database, e.g. with DbOpenRO.
+        
+        SST files are hard-linked when `checkpoint_dir` is on the same
+        filesystem, which makes this nearly instant; writes continue meanwhile.
+        
+        Args:
+            checkpoint_dir (str): Directory to create; it must not exist yet
+            log_size_for_flush (int): Copy the WAL instead of flushing the memtables
+                when it is smaller than this many bytes; 0 always flushes
+        """
+        self._db.create_checkpoint(checkpoint_dir, log_size_for_flush)
+    
+    def snapshot(self) -> Snapshot:
         """
         Create a snapshot of the database.
         
         Returns:
-            object: Snapshot object that can be used with read operations
+            Snapshot: Snapshot object that can be used with read operations
         """
-        return self._db.create_snapshot()
+        return Snapshot(self._db.create_snapshot())
     
-    def release_snapshot(self, snapshot : Any) -> None:
+    def release_snapshot(self, snapshot : Snapshot) -> None:
         """
-        Release a snapshot.
+        Release a snapshot of this database.
         
         Args:
             snapshot: Snapshot to release
+            
+        Raises:
+            ValueError: If the snapshot belongs to a different database
+        """
+        self._db.release_snapshot(snapshot._snapshot)
+    
+    def transaction(self, write_options: Optional[WriteOptions] = None, set_snapshot: bool = False, lock_timeout_ms: int = -1) -> Transaction:
+        """
+        Begin a transaction on a database opened with DbOpenTransaction or
+        DbOpenOptimisticTransaction.
+        
+        Args:
+            write_options (WriteOptions, optional): Options for the commit
+            set_snapshot (bool): Take a snapshot right away, so reads are
+                repeatable and concurrent changes to the keys it touches are
+                conflicts
+            lock_timeout_ms (int): Lock wait for pessimistic transactions,
+                negative for the database default
+        
+        Returns:
+            Transaction: Transaction object, also usable as a context manager
         """
-        self._db.release_snapshot(snapshot)
+        return Transaction(self._db.begin_transaction(write_options, set_snapshot, lock_timeout_ms))
     
-    def compact_range(self, compact_range_options: CompactRangeOptions, from_key: Optional[bytes], to_key: Optional[bytes]) -> None:
+    def ingest_external_file(self, 
+                             paths : Sequence[str], 
+                             cfh : cCFHandle, 
+                             move_files : bool = False, 
+                             snapshot_consistency : bool = True, 
+                             allow_global_seqno : bool = True, 
+                             ingest_behind : bool = False
+                             ) -> None:
+        """
+        Load SST files built with SstFileWriter directly into the LSM tree,
+        bypassing the WAL, memtables and flushes.
+        
+        Args:
+            paths: SST files to ingest
+            cfh (cCFHandle): Column family to ingest into
+            move_files (bool): Hard-link the files instead of copying them
+            snapshot_consistency (bool): Keep the ingested keys invisible to existing snapshots
+            allow_global_seqno (bool): Allow ingestion when the files overlap existing keys
+            ingest_behind (bool): Put the files below all existing data; needs DBOptions.allow_ingest_behind
+        """
+        self._db.ingest_external_file(list(paths), cfh, move_files, snapshot_consistency, allow_global_seqno, ingest_behind)
+    
+    def bulk_ingest(self, 
+                    cfh : cCFHandle, 
+                    items : Iterable[tuple[bytes, bytes]], 
+                    directory : str, 
+                    partitions : int = 8, 
+                    threads : int = 0,
+                    cf_options : Optional[CFOptions] = None,
+                    memory_limit : int = DEFAULT_MEMORY_LIMIT
+                    ) -> list[dict]:
+        """
+        Sort unsorted (key, value) pairs into SST files in parallel and ingest them.
+        
+        The files are written to `directory` and moved into the database, see
+        write_sst_files; `items` is streamed, holding about `memory_limit` bytes
+        of it in memory. Keys already in the database are overwritten.
+        
+        Args:
+            cfh (cCFHandle): Column family to ingest into
+            items: (key, value) pairs in any order, e.g. a generator
+            directory: Scratch directory on the same filesystem as the database
+            partitions (int): Number of SST files to write
+            threads (int): Worker threads, 0 for the number of cores
+            cf_options (CFOptions, optional): Options of the target column family
+            memory_limit (int): Bytes of input to hold in memory at once
+        
+        Returns:
+            list[dict]: smallest_key, largest_key, num_entries and file_size of
+                each ingested file, in key order
+        """
+        infos = []
+        try:
+            infos = _write_sst_files_info(directory, items, partitions, threads, "bulk", None, cf_options, memory_limit)
+            if infos:
+                self.ingest_external_file([info["file_path"] for info in infos], cfh, move_files=True)
+        finally:
+            # Moved files are hard links, the database keeps its own
+            for info in infos:
+                if os.path.exists(info["file_path"]):
+                    os.remove(info["file_path"])
+        return [{name: value for name, value in info.items() if name != "file_path"} for info in infos]
+    
+    def compact_range(self, 
+                      compact_range_options: CompactRangeOptions, 
+                      from_key: Optional[bytes], 
+                      to_key: Optional[bytes], 
+                      cfh: Optional[cCFHandle] = None) -> None:
         """
         Compact a range of keys in the database.
         
@@ -148,11 +585,193 @@ class RocksDB:
             compact_range_options (CompactRangeOptions): Options for the compaction
             from_key (bytes, optional): Start key for the range to compact
             to_key (bytes, optional): End key for the range to compact
+            cfh (cCFHandle, optional): Column family to compact, the default one if None
+        """
+        self._db.compact_range(compact_range_options, from_key, to_key, cfh)
+    
+    def flush(self, cfhs: Optional[Sequence[cCFHandle]] = None, wait: bool = True, allow_write_stall: bool = False) -> None:
+        """
+        Flush memtables to SST files.
+        
+        With DBOptions.atomic_flush set, the column families are flushed
+        together, so their SST files reflect one point in time.
+        
+        Args:
+            cfhs (Sequence[cCFHandle], optional): Column families to flush, all if None
+            wait (bool): Return only once the flush has finished
+            allow_write_stall (bool): Flush at once even if that stalls writes
+        """
+        self._db.flush(cfhs, wait, allow_write_stall)
+    
+    def flush_wal(self, sync: bool = False) -> None:
+        """
+        Write the WAL buffer to the file (only useful with DBOptions.manual_wal_flush).
+        
+        Args:
+            sync (bool): Also fsync the WAL
+        """
+        self._db.flush_wal(sync)
+    
+    def wait_for_compact(self, flush: bool = False, abort_on_pause: bool = False, timeout_ms: int = 0) -> bool:
+        """
+        Wait until no flushes or compactions are running or pending.
+        
+        The GIL is released while waiting.
+        
+        Args:
+            flush (bool): Flush the memtables first and wait for those flushes too
+            abort_on_pause (bool): Raise instead of waiting forever if background work is paused
+            timeout_ms (int): Give up after this long, 0 to wait without limit
+        
+        Returns:
+            bool: True once idle, False if the timeout passed first
+        """
+        return self._db.wait_for_compact(flush, abort_on_pause, timeout_ms)
+    
+    def pause_background_work(self) -> None:
+        """Stop scheduling flushes and compactions and wait for the running ones."""
+        self._db.pause_background_work()
+    
+    def continue_background_work(self) -> None:
+        """Undo one pause_background_work()."""
+        self._db.continue_background_work()
+    
+    def enable_auto_compaction(self, cfhs: Optional[Sequence[cCFHandle]] = None) -> None:
+        """
+        Turn automatic compactions back on, e.g. after opening with
+        CFOptions.disable_auto_compactions, and schedule what is due.
+        
+        Args:
+            cfhs (Sequence[cCFHandle], optional): Column families, all if None
+        """
+        self._db.enable_auto_compaction(cfhs)
+    
+    # Mutable column family options changed by bulk_load(), after
+    # Options::PrepareForBulkLoad: no write stalls and no automatic compactions
+    BULK_LOAD_CF_OPTIONS : dict[str, Any] = {
+        "disable_auto_compactions": True,
+        "level0_file_num_compaction_trigger": 1 << 30,
+        "level0_slowdown_writes_trigger": 1 << 30,
+        "level0_stop_writes_trigger": 1 << 30,
+        "soft_pending_compaction_bytes_limit": 0,
+        "hard_pending_compaction_bytes_limit": 0,
+        "max_compaction_bytes": 1 << 60,
+        "max_write_buffer_number": 6,
+    }
+    
+    @contextlib.contextmanager
+    def bulk_load(self, 
+                  cfhs : Optional[Sequence[cCFHandle]] = None, 
+                  compact : bool = True, 
+                  cf_options : Optional[dict[str, Any]] = None,
+                  db_options : Optional[dict[str, Any]] = None
+                  ) -> Iterator[None]:
         """
-        self._db.compact_range(compact_range_options, from_key, to_key)
+        Switch column families into bulk load mode for the `with` block.
+        
+        On entry BULK_LOAD_CF_OPTIONS (updated with `cf_options`) and `db_options`
+        are applied live with set_options/set_db_options, so loading neither
+        stalls writes nor triggers compactions. If the block succeeded, the column
+        families are then flushed - atomically with DBOptions.atomic_flush - and, if
+        `compact` is set, each is compacted once, all still in bulk load mode so the
+        L0 backlog is gone before writes can stall on it. Finally the previous option
+        values are restored on every column family; if any restore fails, the first
+        error is raised once all have been attempted.
+        
+        Settings that PrepareForBulkLoad changes but that are not mutable, such as
+        num_levels, only take effect through CFOptions.prepare_for_bulk_load() at open.
+        
+        Args:
+            cfhs (Sequence[cCFHandle], optional): Column families being loaded, all if None
+            compact (bool): Compact the column families after loading
+            cf_options (dict, optional): Further column family options to apply during the load
+            db_options (dict, optional): DB options to apply during the load, e.g. {"max_background_jobs": 16}
+        
+        Raises:
+            ValueError: If an option is unknown or not mutable
+        """
+        if cfhs is None:
+            cfhs = list(self.list_column_families().values())
+        cf_settings = dict(self.BULK_LOAD_CF_OPTIONS, **(cf_options or {}))
+        db_settings = dict(db_options or {})
+        
+        def saved_values(current : dict[str, str], settings : dict[str, Any]) -> dict[str, str]:
+            # The current values as option strings, which set_options accepts back as is
+            unknown = [name for name in settings if name not in current]
+            if unknown:
+                raise ValueError(f"Unknown or unsaveable options: {', '.join(unknown)}")
+            return {name: current[name] for name in settings}
+        
+        saved_cf = []
+        saved_db = {}
+        try:
+            if db_settings:
+                saved = saved_values(self._db.get_db_option_strings(), db_settings)
+                self.set_db_options(db_settings)
+                saved_db = saved
+            for cfh in cfhs:
+                saved = saved_values(self._db.get_option_strings(cfh), cf_settings)
+                self.set_options(cfh, cf_settings)
+                saved_cf.append((cfh, saved))
+            yield
+            self.flush(cfhs)
+            if compact:
+                for cfh in cfhs:
+                    self.compact_range(CompactRangeOptions(), None, None, cfh)
+        finally:
+            errors = []
+            for cfh, saved in saved_cf:
+                try:
+                    self.set_options(cfh, saved)
+                except Exception as e:
+                    errors.append(e)
+            if saved_db:
+                try:
+                    self.set_db_options(saved_db)
+                except Exception as e:
+                    errors.append(e)
+            if errors:
+                raise errors[0]
     
+    def get_property(self, name: str, cfh: Optional[cCFHandle] = None) -> str | None:
+        """
+        Read a string property such as "rocksdb.stats" or "rocksdb.levelstats".
+        
+        Args:
+            name: Property name
+            cfh: Column family handle, the default column family if omitted
+        
+        Returns:
+            str | None: Property value, None if the property is unknown
+        """
+        return self._db.get_property(name, cfh)
+    
+    def get_int_property(self, name: str, cfh: Optional[cCFHandle] = None) -> int | None:
+        """
+        Read a numeric property such as "rocksdb.estimate-num-keys" or
+        "rocksdb.block-cache-usage", without formatting it as a string.
+        
+        Returns:
+            int | None: Property value, None if the property is unknown or not numeric
+        """
+        return self._db.get_int_property(name, cfh)
+    
+    def get_map_property(self, name: str, cfh: Optional[cCFHandle] = None) -> dict[str, str] | None:
+        """
+        Read a structured property such as "rocksdb.cfstats" as a dict.
+        
+        Returns:
+            dict | None: Property value, None if the property is unknown
+        """
+        return self._db.get_map_property(name, cfh)
+
     def close(self) -> None:
-        """Close the database."""
+        """
+        Close the database, after closing its iterators, scans, snapshots and transactions.
+        
+        Raises:
+            RuntimeError: If values from get_pinned() or a pinned value_view() are still alive
+        """
         if self._closed:
             return
         for fin in self._fin_set:
@@ -179,6 +798,87 @@ class RocksDB:
         #should literally just be called dict
         return self._db.list_column_families()
 
+    def create_column_family(self, name: str, options: Optional[CFOptions] = None) -> cCFHandle:
+        """
+        Create a column family in the open database.
+
+        Args:
+            name (str): Name of the new column family
+            options (CFOptions, optional): Options of the column family; defaults are used if None
+
+        Returns:
+            cCFHandle: Handle of the new column family
+        """
+        return self._db.create_column_family(name, CFOptions() if options is None else options)
+
+    def create_column_families(self, 
+                               column_families: Sequence[str] | dict[str, CFOptions], 
+                               options: Optional[CFOptions] = None) -> dict[str, cCFHandle]:
+        """
+        Create several column families with a single call into RocksDB.
+
+        Args:
+            column_families (Sequence[str] | dict[str, CFOptions]): Names of the column families,
+                or a dict mapping each name to its options
+            options (CFOptions, optional): Options used for every name when a sequence is given
+
+        Returns:
+            dict[str, cCFHandle]: Handles of the new column families by name
+
+        Raises:
+            RuntimeError: If creation fails. Column families created before the failure stay
+                open and are listed by list_column_families().
+        """
+        if not isinstance(column_families, dict):
+            if options is None:
+                options = CFOptions()
+            column_families = {name: options for name in column_families}
+        return self._db.create_column_families(column_families)
+
+    def drop_column_family(self, cfh: cCFHandle) -> None:
+        """
+        Drop a column family and its data. 
+        
+        The handle, and every copy of it, is invalid afterwards; using it raises RuntimeError.
+        The default column family cannot be dropped.
+        """
+        self._db.drop_column_family(cfh)
+
+    def set_options(self, cfh: cCFHandle, options: dict[str, Any]) -> None:
+        """
+        Change mutable column family options of the live database.
+
+        Args:
+            cfh (cCFHandle): Column family handle
+            options (dict): Option names and values as accepted by RocksDB's SetOptions,
+                e.g. {"write_buffer_size": 64 << 20, "disable_auto_compactions": True}
+
+        Raises:
+            ValueError: If an option is unknown, not mutable or has an invalid value
+        """
+        self._db.set_options(cfh, options)
+
+    def set_db_options(self, options: dict[str, Any]) -> None:
+        """
+        Change mutable DB-wide options of the live database, e.g. {"max_background_jobs": 8}.
+
+        Raises:
+            ValueError: If an option is unknown, not mutable or has an invalid value
+        """
+        self._db.set_db_options(options)
+
+    def get_options(self, cfh: cCFHandle) -> CFOptions:
+        """
+        Get the current options of a column family, including changes made by set_options().
+        """
+        return self._db.get_options(cfh)
+
+    def get_db_options(self) -> DBOptions:
+        """
+        Get the current DB-wide options, including changes made by set_db_options().
+        """
+        return self._db.get_db_options()
+
 #okay
     @classmethod
     def get_column_families(cls, dbname) -> list[str]:
@@ -0,0 +1,75 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cGroupCommitWriter, cCFHandle # type: ignore
+from typing import Optional, Any
+
+class GroupCommitWriter:
+    """
+    Coalesces single-key writes from many threads into shared WriteBatches.
+    
+    Writes are appended to an open batch that a native background thread
+    writes as one DB::Write once it is full (max_count operations or
+    max_bytes) or max_delay_us after its first write. With many concurrent
+    writers this costs one WAL append - and one fsync with sync=True - per
+    batch instead of per key.
+    
+    put/merge/delete wait until their batch is written by default and raise
+    if it fails. With wait=False they return at once; flush() waits for
+    everything added so far and raises the first error of such writes.
+    
+    Create it with RocksDB.group_commit_writer(). It is closed, after
+    writing what is pending, when the `with` block exits, when close() is
+    called or when the database is closed.
+    """
+    
+    def __init__(self, writer_handle : cGroupCommitWriter) -> None:
+        """
+        Initialize the writer.
+        
+        Args:
+            writer_handle: Native writer handle
+        """
+        self._writer = writer_handle
+    
+    def put(self, cfh : cCFHandle, key : bytes, value : bytes, wait : bool = True) -> None:
+        """Store a key-value pair; with `wait`, return once it is written."""
+        self._writer.put(cfh, key, value, wait)
+    
+    def merge(self, cfh : cCFHandle, key : bytes, value : bytes, wait : bool = True) -> None:
+        """Merge an operand into a key; with `wait`, return once it is written."""
+        self._writer.merge(cfh, key, value, wait)
+    
+    def delete(self, cfh : cCFHandle, key : bytes, wait : bool = True) -> None:
+        """Delete a key; with `wait`, return once it is written."""
+        self._writer.delete(cfh, key, wait)
+    
+    def flush(self) -> None:
+        """
+        Write everything added so far and wait for it.
+        
+        Raises:
+            RuntimeError: If a batch with writes made with wait=False failed
+        """
+        self._writer.flush()
+    
+    @property
+    def batches_written(self) -> int:
+        """Number of WriteBatches written so far."""
+        return self._writer.batches_written
+    
+    @property
+    def operations_written(self) -> int:
+        """Number of puts, merges and deletes written so far."""
+        return self._writer.operations_written
+    
+    def close(self) -> None:
+        """Write what is pending and stop the writer, raising like flush()."""
+        try:
+            self._writer.flush()
+        finally:
+            self._writer.close()
+    
+    def __enter__(self) -> GroupCommitWriter:
+        return self
+    
+    def __exit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        self.close()
@@ -1,4 +1,5 @@
-from ._rocksdb_cpp import cIterator # type: ignore
+from ._rocksdb_cpp import cIterator, PinnedValue # type: ignore
+from .columnar import ColumnarBatch
 from typing import Iterator
 
 class DbIterator():
@@ -6,8 +7,16 @@ class DbIterator():
     Iterator for RocksDB databases.
     
     This class provides a pythonic interface for RocksDB iterators.
+    
+    Python iteration (`for key, value in it`) fetches rows from the native
+    iterator in chunks of up to `batch_size` rows / `batch_bytes` bytes, so the
+    native iterator runs ahead of the rows handed out so far. Any positioning
+    call (seek*, next, prev) discards the rows buffered by iteration.
     """
     
+    batch_size : int = 1024
+    batch_bytes : int = 4 * 1024 * 1024
+    
     def __init__(self, iter_handle : cIterator) -> None:
         """
         Initialize the iterator.
@@ -16,13 +25,16 @@ class DbIterator():
             iter_handle: Native iterator handle
         """
         self._iter = iter_handle
+        self._pending : Iterator[tuple[bytes, bytes]] = iter(())
     
     def seek_to_first(self) -> None:
         """Position at the first key in the database."""
+        self._pending = iter(())
         self._iter.seek_to_first()
     
     def seek_to_last(self) -> None:
         """Position at the last key in the database."""
+        self._pending = iter(())
         self._iter.seek_to_last()
     
     def seek(self, key : bytes) -> None:
@@ -32,6 +44,7 @@ class DbIterator():
         Args:
             key (bytes): Key to seek to
         """
+        self._pending = iter(())
         self._iter.seek(key)
     
     def valid(self) -> bool:
@@ -45,10 +58,12 @@ class DbIterator():
     
     def next(self) -> None:
         """Move to the next entry in the database."""
+        self._pending = iter(())
         self._iter.next()
     
     def prev(self) -> None:
         """Move to the previous entry in the database."""
+        self._pending = iter(())
         self._iter.prev()
     
     def key(self) -> bytes:
@@ -79,6 +94,26 @@ class DbIterator():
             raise StopIteration("Iterator not valid")
         return self._iter.value()
     
+    def value_view(self) -> PinnedValue:
+        """
+        Get the value at the current position as a read-only buffer.
+        
+        If the iterator was created with `IteratorOptions.pin_data` and the value
+        lives in a pinned SST block, no copy is made and the view stays valid after
+        the iterator moves on; like get_pinned() values, such a view keeps
+        RocksDB.close() from closing the database. Otherwise the value is copied
+        once into the view.
+        
+        Returns:
+            PinnedValue: Object supporting the buffer protocol (e.g. memoryview)
+            
+        Raises:
+            StopIteration: If the iterator is not valid
+        """
+        if not self.valid():
+            raise StopIteration("Iterator not valid")
+        return self._iter.value_view()
+    
     def __iter__(self) -> Iterator[tuple[bytes,bytes]]:
         """Make this object iterable."""
         return self
@@ -93,11 +128,61 @@ class DbIterator():
         Raises:
             StopIteration: When there are no more items
         """
-        if not self.valid():
+        item = next(self._pending, None)
+        if item is not None:
+            return item
+        
+        chunk = self._iter.next_batch(self.batch_size, self.batch_bytes)
+        if not chunk:
             raise StopIteration
+        self._pending = iter(chunk)
+        return next(self._pending)
+    
+    def next_batch(self, n : int, max_bytes : int = 0, reverse : bool = False) -> list[tuple[bytes, bytes]]:
+        """
+        Read up to `n` key-value pairs from the current position in one native call
+        and advance past them.
         
-        key = self.key()
-        value = self.value()
-        self.next()
+        Args:
+            n (int): Maximum number of pairs to return
+            max_bytes (int): Stop once the keys and values read add up to this many bytes (0 = no limit)
+            reverse (bool): Step backwards (prev) instead of forwards
+            
+        Returns:
+            list: (key, value) tuples, empty when the iterator is exhausted
+        """
+        self._pending = iter(())
+        return self._iter.next_batch(n, max_bytes, reverse)
+    
+    def next_columnar(self, 
+                      n : int, 
+                      max_bytes : int = 0, 
+                      reverse : bool = False, 
+                      key_width : int = 0, 
+                      signed_keys : bool = False
+                      ) -> ColumnarBatch:
+        """
+        Like next_batch, but the rows are written into contiguous native buffers
+        (Arrow large-binary layout) instead of Python objects, see ColumnarBatch.
         
-        return (key, value)
+        Args:
+            n (int): Maximum number of rows to return
+            max_bytes (int): Stop once the keys and values read add up to this many bytes (0 = no limit)
+            reverse (bool): Step backwards (prev) instead of forwards
+            key_width (int): If 1-8, decode keys as big-endian integers of this many bytes
+                into an int64 column instead of copying them
+            signed_keys (bool): Sign-extend decoded keys (two's complement)
+            
+        Returns:
+            ColumnarBatch: Rows read, empty when the iterator is exhausted
+            
+        Raises:
+            RuntimeError: If key_width is set and a key has a different length
+        """
+        self._pending = iter(())
+        return ColumnarBatch(self._iter.next_columnar(n, max_bytes, reverse, key_width, signed_keys))
+    
+    def close(self) -> None:
+        """Release the native iterator. It cannot be used afterwards."""
+        self._pending = iter(())
+        self._iter.close()
@@ -0,0 +1,77 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cParallelScan # type: ignore
+from typing import Optional, Any, Iterator
+
+class ParallelScan:
+    """
+    Scans a key range of one column family on native worker threads.
+    
+    The range is split into partitions at SST file boundaries, balanced by
+    their approximate sizes, and each partition is read by its own bounded
+    iterator. All iterators are created from one snapshot, so the scan sees
+    a single consistent state of the database.
+    
+    A scan is used once: either iterate over it (or over chunks()) to get
+    the rows, in key order unless it was created with ordered=False, or call
+    aggregate() to have the workers count the rows without returning them to
+    Python.
+    
+    Create it with RocksDB.parallel_scan(). It is closed when the `with`
+    block exits, when close() is called or when the database is closed.
+    """
+    
+    def __init__(self, scan_handle : cParallelScan) -> None:
+        """
+        Initialize the scan.
+        
+        Args:
+            scan_handle: Native scan handle
+        """
+        self._scan = scan_handle
+    
+    @property
+    def partitions(self) -> list[tuple[Optional[bytes], Optional[bytes]]]:
+        """(lower, upper) bounds of every partition; None is an open bound."""
+        return self._scan.partitions()
+    
+    def chunks(self) -> Iterator[list[tuple[bytes, bytes]]]:
+        """
+        Yields:
+            list: Chunks of (key, value) pairs as the workers produce them
+        
+        Raises:
+            RuntimeError: If reading any partition fails
+        """
+        while True:
+            chunk = self._scan.next_chunk()
+            if chunk is None:
+                return
+            yield chunk
+    
+    def __iter__(self) -> Iterator[tuple[bytes, bytes]]:
+        for chunk in self.chunks():
+            yield from chunk
+    
+    def aggregate(self) -> dict[str, Any]:
+        """
+        Scan the whole range without returning rows to Python.
+        
+        Returns:
+            dict: count, key_bytes and value_bytes of all rows, and min_key and
+            max_key (None if the range is empty)
+        """
+        return self._scan.aggregate()
+    
+    def count(self) -> int:
+        """Number of keys in the range."""
+        return self.aggregate()["count"]
+    
+    def close(self) -> None:
+        """Stop the workers and release the iterators."""
+        self._scan.close()
+    
+    def __enter__(self) -> ParallelScan:
+        return self
+    
+    def __exit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        self.close()
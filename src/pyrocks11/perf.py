@@ -0,0 +1,38 @@
+from __future__ import annotations
+from ._rocksdb_cpp import PerfLevel, set_perf_level, get_perf_level, reset_perf_context, perf_context, iostats_context # type: ignore
+from typing import Optional, Any
+
+class PerfContext:
+    """
+    Collect RocksDB perf and IO counters for the operations run in a `with` block.
+    
+    The counters are thread-local, so only operations issued from the thread
+    that entered the block are measured. The previous perf level is restored
+    on exit.
+    
+        with PerfContext(PerfLevel.kEnableTimeExceptForMutex) as pc:
+            db.get(cfh, b"key")
+        pc.counters["block_read_count"]
+    """
+    
+    def __init__(self, level : PerfLevel = PerfLevel.kEnableCount) -> None:
+        self.level = level
+        self.counters : dict[str, int] = {}
+        self.io_counters : dict[str, int] = {}
+        self._prev_level : Optional[PerfLevel] = None
+    
+    def __enter__(self) -> PerfContext:
+        self._prev_level = get_perf_level()
+        set_perf_level(self.level)
+        reset_perf_context()
+        return self
+    
+    def __exit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        self.snapshot()
+        set_perf_level(self._prev_level)
+    
+    def snapshot(self) -> dict[str, int]:
+        """Capture the current counters into `counters` and `io_counters`."""
+        self.counters = perf_context()
+        self.io_counters = iostats_context()
+        return self.counters
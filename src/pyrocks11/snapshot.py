@@ -0,0 +1,47 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cSnapshot # type: ignore
+from typing import Optional, Any
+
+class Snapshot:
+    """
+    A point-in-time view of a database.
+    
+    Pass it to RocksDB.get, multi_get, iterator or range to read the state of
+    the database as of the moment the snapshot was taken, regardless of later
+    writes. The snapshot is released when this object is garbage collected,
+    when release() is called, when the `with` block it was used in exits, or
+    when the database is closed.
+    """
+    
+    def __init__(self, snapshot_handle : cSnapshot) -> None:
+        """
+        Initialize the snapshot.
+        
+        Args:
+            snapshot_handle: Native snapshot handle
+        """
+        self._snapshot = snapshot_handle
+    
+    @property
+    def valid(self) -> bool:
+        """True until the snapshot has been released."""
+        return self._snapshot.valid
+    
+    @property
+    def sequence_number(self) -> int:
+        """Sequence number of the last write visible through this snapshot."""
+        return self._snapshot.sequence_number
+    
+    def release(self) -> None:
+        """Release the snapshot. Reads through it fail afterwards."""
+        self._snapshot.release()
+    
+    def __enter__(self) -> Snapshot:
+        return self
+    
+    def __exit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        self.release()
+
+
+def _handle(snapshot : Optional[Snapshot]) -> Optional[cSnapshot]:
+    return snapshot._snapshot if snapshot is not None else None
@@ -0,0 +1,126 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cSstFileWriter, write_sst_files as _write_sst_files # type: ignore
+from .options import DBOptions, CFOptions
+from typing import Optional, Any, Sequence, Iterable
+import os
+
+# Input held in memory by write_sst_files before sorted runs are spilled to disk
+DEFAULT_MEMORY_LIMIT = 256 << 20
+
+class SstFileWriter:
+    """
+    Writes an SST file that can be loaded with RocksDB.ingest_external_file.
+    
+    Keys must be added in strictly increasing order. `cf_options` should match
+    the options of the column family the file will be ingested into (at least
+    its comparator and table format).
+    
+        with SstFileWriter("/tmp/load/000001.sst") as writer:
+            writer.put_many(sorted_items)
+    """
+    
+    def __init__(self, path : str, options : Optional[DBOptions] = None, cf_options : Optional[CFOptions] = None) -> None:
+        """
+        Create the file and open it for writing.
+        
+        Args:
+            path: Path of the SST file to create
+            options (DBOptions, optional): Database options
+            cf_options (CFOptions, optional): Options of the target column family
+        """
+        self._writer = cSstFileWriter(options if options is not None else DBOptions(), 
+                                      cf_options if cf_options is not None else CFOptions())
+        self._writer.open(path)
+        self.path = path
+        self.info : Optional[dict] = None
+    
+    def put(self, key : bytes, value : bytes) -> None:
+        """Add a key, which must sort after every key added so far."""
+        self._writer.put(key, value)
+    
+    def delete(self, key : bytes) -> None:
+        """Add a deletion marker for a key."""
+        self._writer.delete(key)
+    
+    def put_many(self, items : Sequence[tuple[bytes, bytes]]) -> None:
+        """
+        Add a sorted chunk of (key, value) pairs. The GIL is released while
+        the chunk is written.
+        """
+        self._writer.put_many(items)
+    
+    @property
+    def file_size(self) -> int:
+        """Size of the data written so far."""
+        return self._writer.file_size()
+    
+    def finish(self) -> dict:
+        """
+        Finish the file. It can be ingested afterwards.
+        
+        Returns:
+            dict: file_path, smallest_key, largest_key, num_entries and file_size
+        """
+        self.info = self._writer.finish()
+        return self.info
+    
+    def __enter__(self) -> SstFileWriter:
+        return self
+    
+    def __exit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        if exc_type is None and self.info is None:
+            self.finish()
+
+
+def write_sst_files(directory : str,
+                    items : Iterable[tuple[bytes, bytes]],
+                    partitions : int,
+                    threads : int = 0,
+                    prefix : str = "bulk",
+                    options : Optional[DBOptions] = None,
+                    cf_options : Optional[CFOptions] = None,
+                    memory_limit : int = DEFAULT_MEMORY_LIMIT
+                    ) -> list[str]:
+    """
+    Sort unsorted (key, value) pairs and write them as non-overlapping SST files.
+    
+    The keys are range-partitioned into up to `partitions` files, which are
+    sorted and written in parallel on `threads` native threads (0 for one per
+    core) with the GIL released. For duplicate keys the last pair wins.
+    
+    `items` is consumed as a stream and copied in chunks of about `memory_limit`
+    bytes. Input larger than that is sorted chunk by chunk into temporary run
+    files in `directory`, which are merged into the output at the end, so it
+    needs about twice its size in free disk space. On failure no files are left.
+    
+    Args:
+        directory: Directory for the files, created if missing
+        items: (key, value) pairs in any order, e.g. a generator
+        partitions: Number of files to split the data into
+        threads (int): Worker threads, 0 for the number of cores
+        prefix (str): File name prefix, files are named <prefix>-NNNNNN.sst
+        options (DBOptions, optional): Database options
+        cf_options (CFOptions, optional): Options of the target column family
+        memory_limit (int): Bytes of input to hold in memory at once
+    
+    Returns:
+        list[str]: Paths of the files written, in key order
+    """
+    return [info["file_path"] for info in _write_sst_files_info(directory, items, partitions, threads, prefix, 
+                                                                 options, cf_options, memory_limit)]
+
+
+def _write_sst_files_info(directory : str,
+                          items : Iterable[tuple[bytes, bytes]],
+                          partitions : int,
+                          threads : int,
+                          prefix : str,
+                          options : Optional[DBOptions],
+                          cf_options : Optional[CFOptions],
+                          memory_limit : int
+                          ) -> list[dict]:
+    # write_sst_files, returning SstFileWriter.finish() info for each file
+    os.makedirs(directory, exist_ok=True)
+    return _write_sst_files(options if options is not None else DBOptions(),
+                            cf_options if cf_options is not None else CFOptions(),
+                            directory, prefix, items, partitions, threads, memory_limit)
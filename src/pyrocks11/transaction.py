@@ -0,0 +1,121 @@
+from __future__ import annotations
+from ._rocksdb_cpp import cTransaction, cCFHandle, ReadOptions # type: ignore
+from typing import Optional, Any
+
+class Transaction:
+    """
+    A transaction of a database opened with DbOpenTransaction or
+    DbOpenOptimisticTransaction.
+    
+    Writes are buffered until commit() and are visible to get() and
+    get_for_update() of this transaction only. Pessimistic transactions lock
+    the keys they write or read for update and raise TransactionConflict when
+    a lock cannot be taken in time; optimistic ones raise it from commit()
+    when another writer changed a tracked key first. Either way the
+    transaction should be rolled back and retried.
+    
+    Used as a context manager it commits when the block exits normally and
+    rolls back when it raises. Commit, rollback and lock waits run without
+    the GIL.
+    """
+    
+    def __init__(self, txn_handle : cTransaction) -> None:
+        """
+        Initialize the transaction.
+        
+        Args:
+            txn_handle: Native transaction handle
+        """
+        self._txn = txn_handle
+        self._finished = False
+    
+    def put(self, cfh: cCFHandle, key: bytes, value: bytes) -> None:
+        """Write a key-value pair, locking the key for pessimistic transactions."""
+        self._txn.put(cfh, key, value)
+    
+    def delete(self, cfh: cCFHandle, key: bytes) -> None:
+        """Delete a key, locking it for pessimistic transactions."""
+        self._txn.delete(cfh, key)
+    
+    def merge(self, cfh: cCFHandle, key: bytes, value: bytes) -> None:
+        """Merge an operand into a key using the column family's merge operator."""
+        self._txn.merge(cfh, key, value)
+    
+    def get(self, cfh: cCFHandle, key: bytes, read_options: Optional[ReadOptions] = None) -> bytes | None:
+        """
+        Read a key, including this transaction's own writes.
+        
+        Reads are as of the transaction's snapshot if it has one, otherwise
+        of the latest state. The key is not locked or tracked. A snapshot set
+        on read_options is rejected with ValueError.
+        """
+        return self._txn.get(cfh, key, read_options)
+    
+    def get_for_update(self, cfh: cCFHandle, key: bytes, exclusive: bool = True, read_options: Optional[ReadOptions] = None) -> bytes | None:
+        """
+        Read a key and lock it (pessimistic) or track it for conflicts at
+        commit (optimistic), for read-modify-write cycles.
+        
+        Args:
+            cfh (cCFHandle): Column family handle
+            key (bytes): Key to read
+            exclusive (bool): Take a write lock rather than a shared one
+            read_options (ReadOptions, optional): Options for the read
+        
+        Raises:
+            TransactionConflict: If the key is locked by another transaction,
+                or was written after this transaction's snapshot
+        """
+        return self._txn.get_for_update(cfh, key, exclusive, read_options)
+    
+    def set_savepoint(self) -> None:
+        """Remember the current state to roll back to with rollback_to_savepoint()."""
+        self._txn.set_savepoint()
+    
+    def rollback_to_savepoint(self) -> None:
+        """Undo the writes made since the most recent savepoint and remove it."""
+        self._txn.rollback_to_savepoint()
+    
+    def pop_savepoint(self) -> None:
+        """Remove the most recent savepoint without undoing anything."""
+        self._txn.pop_savepoint()
+    
+    def set_snapshot(self) -> None:
+        """
+        Take a snapshot now. Later reads see the database as of this point,
+        and keys read for update or written conflict with any change made
+        after it.
+        """
+        self._txn.set_snapshot()
+    
+    @property
+    def has_snapshot(self) -> bool:
+        """True once the transaction has a snapshot."""
+        return self._txn.has_snapshot
+    
+    def commit(self) -> None:
+        """
+        Atomically apply the transaction's writes.
+        
+        Raises:
+            TransactionConflict: If an optimistic transaction conflicts with
+                another writer; nothing is written
+        """
+        self._finished = True
+        self._txn.commit()
+    
+    def rollback(self) -> None:
+        """Discard the transaction's writes and release its locks."""
+        self._finished = True
+        self._txn.rollback()
+    
+    def __enter__(self) -> Transaction:
+        return self
+    
+    def __exit__(self, exc_type: Optional[type], exc_val: Optional[BaseException], exc_tb: Optional[Any]) -> None:
+        if self._finished or not self._txn.valid:
+            return
+        if exc_type is None:
+            self.commit()
+        else:
+            self.rollback()
@@ -0,0 +1,133 @@
+import asyncio
+import os
+import shutil
+import statistics
+import time
+import unittest
+from pyrocks11 import RocksDB, AsyncRocksDB, DBOptions, CFOptions, WriteBatch
+from tests.utils import benchmarks_enabled
+
+class TestAsync(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_async"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        self.db = RocksDB.open(self.db_path, dbo, CFOptions())
+        self.cfh = self.db.get_column_family_handle("default")
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def test_get_put(self):
+        async def main():
+            async with AsyncRocksDB(self.db) as adb:
+                await adb.put(self.cfh, b"a", b"1")
+                self.assertEqual(await adb.get(self.cfh, b"a"), b"1")
+                self.assertIsNone(await adb.get(self.cfh, b"missing"))
+                self.assertEqual(await adb.multi_get(self.cfh, [b"a", b"missing"]), [b"1", None])
+        asyncio.run(main())
+        self.assertEqual(self.db.get(self.cfh, b"a"), b"1")
+
+    def test_write(self):
+        async def main():
+            async with AsyncRocksDB(self.db) as adb:
+                batch = WriteBatch()
+                batch.put(self.cfh, b"a", b"1")
+                batch.put(self.cfh, b"b", b"2")
+                await adb.write(batch)
+                self.assertEqual(await adb.multi_get(self.cfh, [b"a", b"b"]), [b"1", b"2"])
+        asyncio.run(main())
+
+    def test_concurrent_requests(self):
+        n = 2000
+        for i in range(n):
+            self.db.put(self.cfh, f"key{i:05d}".encode(), f"value{i}".encode())
+
+        async def main():
+            async with AsyncRocksDB(self.db, threads=4) as adb:
+                return await asyncio.gather(*(adb.get(self.cfh, f"key{i:05d}".encode()) for i in range(n)))
+        values = asyncio.run(main())
+        self.assertEqual(values, [f"value{i}".encode() for i in range(n)])
+
+    def test_range(self):
+        for i in range(1000):
+            self.db.put(self.cfh, f"key{i:04d}".encode(), b"v")
+
+        async def collect(adb, start, end, reverse=False):
+            return [key async for key, _ in adb.range(self.cfh, start, end, reverse)]
+
+        async def main():
+            async with AsyncRocksDB(self.db) as adb:
+                adb.batch_size = 64
+                keys = await collect(adb, b"key0100", b"key0900")
+                self.assertEqual(keys, [f"key{i:04d}".encode() for i in range(100, 900)])
+                keys = await collect(adb, None, b"key0010", reverse=True)
+                self.assertEqual(keys, [f"key{i:04d}".encode() for i in reversed(range(10))])
+                self.assertEqual(await collect(adb, b"x", None), [])
+        asyncio.run(main())
+
+    def test_snapshot(self):
+        self.db.put(self.cfh, b"k", b"old")
+        with self.db.snapshot() as snapshot:
+            self.db.put(self.cfh, b"k", b"new")
+
+            async def main():
+                async with AsyncRocksDB(self.db) as adb:
+                    self.assertEqual(await adb.get(self.cfh, b"k", snapshot), b"old")
+                    self.assertEqual([row async for row in adb.range(self.cfh, None, None, snapshot=snapshot)], [(b"k", b"old")])
+            asyncio.run(main())
+
+    def test_errors(self):
+        async def main():
+            adb = AsyncRocksDB(self.db)
+            self.db.close()
+            with self.assertRaises(RuntimeError):
+                await adb.get(self.cfh, b"a")
+            adb.close()
+            with self.assertRaises(RuntimeError):
+                await adb.get(self.cfh, b"a")
+        asyncio.run(main())
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_latency_under_load_benchmark(self):
+        n_keys, n_clients, n_requests = 100000, 64, 200
+        batch = WriteBatch()
+        for i in range(n_keys):
+            batch.put(self.cfh, f"key{i:08d}".encode(), b"v" * 100)
+        self.db.write(batch)
+
+        async def run(get):
+            latencies = []
+            async def client(c):
+                for r in range(n_requests):
+                    key = f"key{(c * 7919 + r * 104729) % n_keys:08d}".encode()
+                    start = time.perf_counter()
+                    await get(key)
+                    latencies.append(time.perf_counter() - start)
+            start = time.perf_counter()
+            await asyncio.gather(*(client(c) for c in range(n_clients)))
+            elapsed = time.perf_counter() - start
+            latencies.sort()
+            return elapsed, statistics.median(latencies), latencies[int(len(latencies) * 0.99)]
+
+        async def main():
+            loop = asyncio.get_running_loop()
+            baseline = await run(lambda key: loop.run_in_executor(None, self.db.get, self.cfh, key))
+            async with AsyncRocksDB(self.db) as adb:
+                native = await run(lambda key: adb.get(self.cfh, key))
+            return baseline, native
+
+        baseline, native = asyncio.run(main())
+        total = n_clients * n_requests
+        for name, (elapsed, p50, p99) in (("run_in_executor", baseline), ("AsyncRocksDB", native)):
+            print(f"\n{name}: {total / elapsed:.0f} gets/s, p50 {p50 * 1e6:.0f} us, p99 {p99 * 1e6:.0f} us")
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,114 @@
+import os
+import shutil
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, DbOpenRO, BackupEngine, BackupEngineOptions, WriteBatch
+
+class TestBackup(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_backup"
+        self.backup_path = "test_database_backup_backups"
+        self.restore_path = "test_database_backup_restored"
+        self.checkpoint_path = "test_database_backup_checkpoint"
+        self.paths = [self.db_path, self.backup_path, self.restore_path, self.checkpoint_path]
+        # Clean up any existing database
+        for path in self.paths:
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        self.db = RocksDB.open(self.db_path, dbo, CFOptions())
+        self.cfh = self.db.get_column_family_handle("default")
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        for path in self.paths:
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+    def _fill(self, prefix, n, value_size=100):
+        batch = WriteBatch()
+        for i in range(n):
+            batch.put(self.cfh, f"{prefix}{i:06d}".encode(), os.urandom(value_size))
+        self.db.write(batch)
+
+    def _read_only(self, path):
+        db = RocksDB.open(path, DBOptions(), CFOptions(), DbOpenRO())
+        return db, db.get_column_family_handle("default")
+
+    def test_checkpoint(self):
+        self._fill("a", 1000)
+        self.db.create_checkpoint(self.checkpoint_path)
+        # Later writes do not show up in the checkpoint
+        self.db.put(self.cfh, b"later", b"v")
+
+        db, cfh = self._read_only(self.checkpoint_path)
+        with db:
+            self.assertEqual(len(list(db.range(cfh, None, None))), 1000)
+            self.assertIsNone(db.get(cfh, b"later"))
+
+        with self.assertRaises(RuntimeError):
+            self.db.create_checkpoint(self.checkpoint_path)
+
+    def test_incremental_backup_and_restore(self):
+        self._fill("a", 1000)
+        with BackupEngine.open(self.backup_path) as engine:
+            first = engine.create_backup(self.db, flush_before_backup=True, app_metadata="first")
+            self._fill("b", 1000)
+            second = engine.create_backup(self.db, flush_before_backup=True)
+
+            backups = engine.backups()
+            self.assertEqual([b["backup_id"] for b in backups], [first, second])
+            self.assertEqual(backups[0]["app_metadata"], "first")
+            engine.verify(first)
+            engine.verify(second, verify_with_checksum=True)
+
+            engine.restore(self.restore_path)
+            db, cfh = self._read_only(self.restore_path)
+            with db:
+                self.assertEqual(len(list(db.range(cfh, None, None))), 2000)
+            shutil.rmtree(self.restore_path)
+
+            engine.restore(self.restore_path, first)
+            db, cfh = self._read_only(self.restore_path)
+            with db:
+                self.assertEqual(len(list(db.range(cfh, None, None))), 1000)
+                self.assertIsNone(db.get(cfh, b"b000000"))
+
+            engine.purge_old_backups(1)
+            self.assertEqual([b["backup_id"] for b in engine.backups()], [second])
+            with self.assertRaises(RuntimeError):
+                engine.verify(first)
+
+    def test_progress_and_limits(self):
+        self._fill("a", 20000, value_size=200)
+        options = BackupEngineOptions(self.backup_path)
+        options.callback_trigger_interval_size = 64 * 1024
+        options.max_background_operations = 4
+        options.backup_rate_limit = 64 * 1024 * 1024
+        progress = []
+        with BackupEngine.open(options) as engine:
+            engine.create_backup(self.db, flush_before_backup=True, progress=progress.append)
+            self.assertTrue(progress)
+            self.assertEqual(progress, sorted(progress))
+
+            # The callback's exception is raised once the backup has finished
+            def fail(copied):
+                raise KeyError("abort")
+            self._fill("b", 20000, value_size=200)
+            with self.assertRaises(KeyError):
+                engine.create_backup(self.db, flush_before_backup=True, progress=fail)
+
+    def test_closed(self):
+        engine = BackupEngine.open(self.backup_path)
+        engine.close()
+        with self.assertRaises(RuntimeError):
+            engine.create_backup(self.db)
+        self.db.close()
+        with BackupEngine.open(self.backup_path) as engine:
+            with self.assertRaises(RuntimeError):
+                engine.create_backup(self.db)
+
+if __name__ == '__main__':
+    unittest.main()
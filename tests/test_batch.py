@@ -1,5 +1,8 @@
+import array
+import ctypes
 import os
 import shutil
+import sys
 import unittest
 from pyrocks11 import RocksDB, DBOptions, WriteBatch
 
@@ -67,4 +70,83 @@ class TestBatch(unittest.TestCase):
         # Keys should not exist
         self.assertEqual(self.db.get(cfh=self.default_cf,key=b"key1"), None)
         self.assertEqual(self.db.get(cfh=self.default_cf,key=b"key2"), None)
+    
+    def test_buffer_arguments(self):
+        batch = WriteBatch()
+        batch.put(self.default_cf, bytearray(b"key1"), memoryview(b"xxvalue1")[2:])
+        batch.put(self.default_cf, memoryview(b"key2"), array.array("B", b"value2"))
+        batch.delete(self.default_cf, bytearray(b"key3"))
+        with self.assertRaises(TypeError):
+            batch.put(self.default_cf, "key4", b"value4")
+        self.db.write(batch)
+        self.assertEqual(self.db.get(self.default_cf, b"key1"), b"value1")
+        self.assertEqual(self.db.get(self.default_cf, b"key2"), b"value2")
+    
+    def test_put_many(self):
+        batch = WriteBatch()
+        keys = [f"key{i:03d}".encode() for i in range(100)]
+        batch.put_many(self.default_cf, keys, [bytearray(k) for k in keys])
+        self.assertEqual(batch.count(), 100)
+        with self.assertRaises(ValueError):
+            batch.put_many(self.default_cf, keys, keys[:-1])
+        self.db.write(batch)
+        self.assertEqual(self.db.multi_get(self.default_cf, keys), keys)
+    
+    def test_put_packed(self):
+        keys = [f"key{i:03d}".encode() for i in range(100)]
+        values = [b"v" * i for i in range(100)]
+
+        def offsets(items, typecode):
+            rv = array.array(typecode, [0])
+            for item in items:
+                rv.append(rv[-1] + len(item))
+            return rv
+
+        batch = WriteBatch()
+        batch.put_packed(self.default_cf, b"".join(keys), offsets(keys, "i"), bytearray(b"".join(values)), offsets(values, "Q"))
+        self.assertEqual(batch.count(), 100)
+        self.db.write(batch)
+        self.assertEqual(self.db.multi_get(self.default_cf, keys), values)
+
+        bad = offsets(keys, "q")
+        bad[-1] += 1
+        with self.assertRaises(ValueError):
+            batch.put_packed(self.default_cf, b"".join(keys), bad, b"".join(keys), offsets(keys, "q"))
+        with self.assertRaises(ValueError):
+            batch.put_packed(self.default_cf, b"".join(keys), offsets(keys, "q"), b"", array.array("q", [0]))
+        with self.assertRaises(ValueError):
+            batch.put_packed(self.default_cf, b"".join(keys), offsets(keys, "d"), b"".join(keys), offsets(keys, "q"))
+
+        # ctypes arrays carry a byte order prefix; only the native order is accepted
+        swapped_type = ctypes.c_int64.__ctype_be__ if sys.byteorder == "little" else ctypes.c_int64.__ctype_le__
+        swapped = (swapped_type * 101)(*offsets(keys, "q"))
+        native = (ctypes.c_int64 * 101)(*offsets(keys, "q"))
+        batch.clear()
+        batch.put_packed(self.default_cf, b"".join(keys), native, b"".join(keys), offsets(keys, "q"))
+        self.assertEqual(batch.count(), 100)
+        with self.assertRaises(ValueError):
+            batch.put_packed(self.default_cf, b"".join(keys), swapped, b"".join(keys), offsets(keys, "q"))
+
+    def test_str_keys(self):
+        batch = WriteBatch()
+        batch.put(self.default_cf, "k\u00e9y", "v\u00e4lue")
+        batch.delete(self.default_cf, "gone")
+        self.db.write(batch)
+        self.assertEqual(self.db.get(self.default_cf, "k\u00e9y".encode()), "v\u00e4lue".encode())
+    
+    def test_data_round_trip(self):
+        batch = WriteBatch()
+        batch.put(self.default_cf, b"key1", b"value1")
+        batch.delete(self.default_cf, b"key2")
+        data = batch.data()
+        self.assertEqual(batch.data_size(), len(data))
+
+        copy = WriteBatch.from_data(data)
+        self.assertEqual(copy.count(), 2)
+        self.db.put(self.default_cf, b"key2", b"value2")
+        self.db.write(copy)
+        self.assertEqual(self.db.get(self.default_cf, b"key1"), b"value1")
+        self.assertIsNone(self.db.get(self.default_cf, b"key2"))
 
+        with self.assertRaises(ValueError):
+            WriteBatch.from_data(b"short")
@@ -0,0 +1,97 @@
+import os
+import shutil
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, Cache, BlockBasedTableOptions, CompactRangeOptions, IteratorOptions, ReadOptions
+
+class TestCache(unittest.TestCase):
+    def setUp(self):
+        self.db_paths = ["test_database_cache_a", "test_database_cache_b"]
+        # Clean up any existing databases
+        for path in self.db_paths:
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+    def tearDown(self):
+        # Clean up
+        for path in self.db_paths:
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+    def _open(self, path, cache, row_cache=None):
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        if row_cache is not None:
+            dbo.row_cache = row_cache
+
+        bbto = BlockBasedTableOptions()
+        bbto.block_cache = cache
+        cfo = CFOptions()
+        cfo.set_block_based_table(bbto)
+        return RocksDB.open(path, dbo, cfo)
+
+    def _fill_and_read(self, db):
+        cfh = db.get_column_family_handle("default")
+        for i in range(1000):
+            db.put(cfh, f"key{i:05d}".encode(), b"v" * 100)
+        db.compact_range(CompactRangeOptions(), None, None)
+        for i in range(1000):
+            self.assertEqual(db.get(cfh, f"key{i:05d}".encode()), b"v" * 100)
+
+    def test_cache_construction(self):
+        lru = Cache.lru(8 * 1024 * 1024, num_shard_bits=4, strict_capacity_limit=True, high_pri_pool_ratio=0.2)
+        self.assertEqual(lru.capacity, 8 * 1024 * 1024)
+        self.assertTrue(lru.strict_capacity_limit)
+        self.assertEqual(lru.usage, 0)
+
+        lru.capacity = 4 * 1024 * 1024
+        self.assertEqual(lru.to_dict()["capacity"], 4 * 1024 * 1024)
+
+        hcc = Cache.hyper_clock(16 * 1024 * 1024)
+        self.assertEqual(hcc.capacity, 16 * 1024 * 1024)
+
+    def test_shared_block_cache(self):
+        for cache in (Cache.lru(32 * 1024 * 1024), Cache.hyper_clock(32 * 1024 * 1024)):
+            db_a = self._open(self.db_paths[0], cache)
+            db_b = self._open(self.db_paths[1], cache)
+
+            self._fill_and_read(db_a)
+            usage_a = cache.usage
+            self.assertGreater(usage_a, 0)
+
+            # Blocks read through the second DB land in the same cache
+            self._fill_and_read(db_b)
+            self.assertGreater(cache.usage, usage_a)
+            self.assertLessEqual(cache.pinned_usage, cache.usage)
+
+            db_a.close()
+            db_b.close()
+            for path in self.db_paths:
+                shutil.rmtree(path)
+
+    def test_row_cache(self):
+        row_cache = Cache.lru(4 * 1024 * 1024)
+        db = self._open(self.db_paths[0], Cache.lru(8 * 1024 * 1024), row_cache)
+        self._fill_and_read(db)
+        self.assertGreater(row_cache.usage, 0)
+        db.close()
+
+    def test_scan_without_fill_cache(self):
+        cache = Cache.lru(8 * 1024 * 1024)
+        db = self._open(self.db_paths[0], cache)
+        cfh = db.get_column_family_handle("default")
+        for i in range(1000):
+            db.put(cfh, f"key{i:05d}".encode(), b"v" * 100)
+        db.compact_range(CompactRangeOptions(), None, None)
+
+        # Unset IteratorOptions fields leave the ReadOptions of the call in effect
+        ro = ReadOptions()
+        ro.fill_cache = False
+        self.assertIsNone(IteratorOptions().fill_cache)
+        self.assertEqual(len(list(db.range(cfh, None, None, read_options=ro))), 1000)
+        self.assertEqual(cache.usage, 0)
+
+        opts = IteratorOptions()
+        opts.fill_cache = True
+        self.assertEqual(len(list(db.range(cfh, None, None, options=opts, read_options=ro))), 1000)
+        self.assertGreater(cache.usage, 0)
+        db.close()
@@ -125,4 +125,93 @@ class TestColumnFamilies(unittest.TestCase):
         # Get binary data from different column families
         self.assertEqual(self.db.get(self.default_cf, binary_key), binary_value_default)
         self.assertEqual(self.db.get(self.cf1, binary_key), binary_value_cf1)
-        self.assertEqual(self.db.get(self.cf2, binary_key), binary_value_cf2)
\ No newline at end of file
+        self.assertEqual(self.db.get(self.cf2, binary_key), binary_value_cf2)
+    
+    def test_multi_get_across_column_families(self):
+        """Test batched lookups spanning several column families."""
+        self.db.put(self.default_cf, b"key1", b"default_value")
+        self.db.put(self.cf1, b"key1", b"cf1_value")
+        self.db.put(self.cf2, b"key2", b"cf2_value")
+
+        values = self.db.multi_get_cf([self.cf1, self.default_cf, self.cf2, self.cf2],
+                                      [b"key1", b"key1", b"key1", b"key2"])
+        self.assertEqual(values, [b"cf1_value", b"default_value", None, b"cf2_value"])
+
+        # One handle per key is required
+        self.assertRaises(ValueError, self.db.multi_get_cf, [self.cf1], [b"key1", b"key2"])
+
+    def test_create_column_family(self):
+        """Test creating a column family on the open database."""
+        cf3 = self.db.create_column_family("cf3")
+        self.db.put(cf3, b"key1", b"cf3_value")
+        self.assertEqual(self.db.get(cf3, b"key1"), b"cf3_value")
+        self.assertEqual(self.db.get(self.cf1, b"key1"), None)
+        self.assertIn("cf3", self.db.list_column_families())
+        self.db.put(self.db.get_column_family_handle("cf3"), b"key2", b"value2")
+        self.assertEqual(self.db.get(cf3, b"key2"), b"value2")
+
+        # Names must be unique
+        self.assertRaises(RuntimeError, self.db.create_column_family, "cf3")
+
+    def test_create_column_families(self):
+        """Test creating several column families in one call."""
+        handles = self.db.create_column_families([f"batch{i}" for i in range(8)])
+        self.assertEqual(sorted(handles), sorted(f"batch{i}" for i in range(8)))
+        for name, cfh in handles.items():
+            self.db.put(cfh, b"name", name.encode())
+        for name, cfh in handles.items():
+            self.assertEqual(self.db.get(cfh, b"name"), name.encode())
+
+        options = CFOptions()
+        options.write_buffer_size = 8 << 20
+        handles = self.db.create_column_families({"small": CFOptions(), "large": options})
+        self.assertEqual(self.db.get_options(handles["large"]).write_buffer_size, 8 << 20)
+
+        self.db.close()
+        self.assertIn("batch7", RocksDB.get_column_families(self.db_path))
+        self.assertIn("large", RocksDB.get_column_families(self.db_path))
+        self.db = RocksDB.open_blind(self.db_path)
+        cfh = self.db.get_column_family_handle("batch3")
+        self.assertEqual(self.db.get(cfh, b"name"), b"batch3")
+
+    def test_drop_column_family(self):
+        """Test that dropping a column family invalidates all copies of its handle."""
+        self.db.put(self.cf2, b"key1", b"cf2_value")
+        cf2_copy = self.db.list_column_families()["cf2"]
+        self.db.drop_column_family(self.cf2)
+
+        self.assertNotIn("cf2", self.db.list_column_families())
+        self.assertRaises(RuntimeError, self.db.get_column_family_handle, "cf2")
+        self.assertRaises(RuntimeError, self.db.get, self.cf2, b"key1")
+        self.assertRaises(RuntimeError, self.db.put, cf2_copy, b"key1", b"value")
+        self.assertRaises(RuntimeError, self.db.drop_column_family, self.cf2)
+
+        # Other column families are unaffected, and the name can be reused
+        self.db.put(self.cf1, b"key1", b"cf1_value")
+        self.assertEqual(self.db.get(self.cf1, b"key1"), b"cf1_value")
+        cf2 = self.db.create_column_family("cf2")
+        self.assertEqual(self.db.get(cf2, b"key1"), None)
+        self.assertRaises(RuntimeError, self.db.get, self.cf2, b"key1")
+
+    def test_set_options(self):
+        """Test changing mutable options of the live database."""
+        self.db.set_options(self.cf1, {"write_buffer_size": 16 << 20, "disable_auto_compactions": True})
+        options = self.db.get_options(self.cf1)
+        self.assertEqual(options.write_buffer_size, 16 << 20)
+        self.assertTrue(options.disable_auto_compactions)
+        self.assertFalse(self.db.get_options(self.cf2).disable_auto_compactions)
+
+        self.db.set_options(self.cf1, {"disable_auto_compactions": False})
+        self.assertFalse(self.db.get_options(self.cf1).disable_auto_compactions)
+
+        self.db.set_db_options({"max_background_jobs": 5})
+        self.assertEqual(self.db.get_db_options().max_background_jobs, 5)
+
+        self.db.put(self.cf1, b"key1", b"cf1_value")
+        self.assertEqual(self.db.get(self.cf1, b"key1"), b"cf1_value")
+
+    def test_set_options_invalid(self):
+        """Test that unknown or immutable options are rejected."""
+        self.assertRaises(ValueError, self.db.set_options, self.cf1, {"no_such_option": 1})
+        self.assertRaises(ValueError, self.db.set_options, self.cf1, {"write_buffer_size": "not a number"})
+        self.assertRaises(ValueError, self.db.set_db_options, {"create_if_missing": True})
@@ -0,0 +1,122 @@
+import importlib.util
+import os
+import shutil
+import struct
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions
+
+HAVE_NUMPY = importlib.util.find_spec("numpy") is not None
+HAVE_PYARROW = importlib.util.find_spec("pyarrow") is not None
+
+class TestColumnar(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_columnar"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        self.db = RocksDB.open(self.db_path, dbo, CFOptions())
+        self.cfh = self.db.get_column_family_handle("default")
+        self.items = [(f"key{i:03d}".encode(), b"v" * (i % 7)) for i in range(100)]
+        for k, v in self.items:
+            self.db.put(self.cfh, k, v)
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def test_buffers(self):
+        it = self.db.iterator(self.cfh)
+        it.seek_to_first()
+        batch = it.next_columnar(10)
+        self.assertEqual(len(batch), 10)
+        self.assertFalse(batch.has_int_keys)
+
+        key_offsets = memoryview(batch.key_offsets)
+        self.assertEqual(key_offsets.format, "q")
+        self.assertEqual(len(key_offsets), 11)
+        key_data = bytes(batch.key_data)
+        self.assertEqual(key_data, b"".join(k for k, _ in self.items[:10]))
+        self.assertEqual(key_data[key_offsets[3]:key_offsets[4]], b"key003")
+        self.assertEqual(list(memoryview(batch.value_offsets))[-1], len(bytes(batch.value_data)))
+
+        # The iterator continues after the rows returned
+        self.assertEqual(batch.to_list(), self.items[:10])
+        self.assertEqual(it.next_columnar(1000).to_list(), self.items[10:])
+        self.assertEqual(len(it.next_columnar(10)), 0)
+        it.close()
+
+    def test_buffers_outlive_batch(self):
+        it = self.db.iterator(self.cfh)
+        it.seek_to_first()
+        view = memoryview(it.next_columnar(5).key_data)
+        it.close()
+        self.assertEqual(bytes(view), b"".join(k for k, _ in self.items[:5]))
+
+    def test_max_bytes_and_reverse(self):
+        it = self.db.iterator(self.cfh)
+        it.seek_to_last()
+        batch = it.next_columnar(100, max_bytes=1, reverse=True)
+        self.assertEqual(batch.to_list(), [self.items[-1]])
+        it.close()
+
+    def test_int_keys(self):
+        cfh = self.db.create_column_family("ints")
+        keys = [1, 2, 1 << 40, (1 << 63) + 5]
+        for k in keys:
+            self.db.put(cfh, struct.pack(">Q", k), b"")
+        batches = list(self.db.range_columnar(cfh, None, None, key_width=8))
+        self.assertEqual(len(batches), 1)
+        self.assertTrue(batches[0].has_int_keys)
+        self.assertEqual(len(bytes(batches[0].key_data)), 0)
+        # Eight-byte keys are reinterpreted as int64
+        self.assertEqual(list(memoryview(batches[0].int_keys)), [1, 2, 1 << 40, -(1 << 63) + 5])
+
+        for k in (-3, 5):
+            self.db.put(self.cfh, struct.pack(">h", k), b"")
+        it = self.db.iterator(self.cfh)
+        it.seek(b"\x00")
+        self.assertEqual(list(memoryview(it.next_columnar(1, key_width=2).int_keys)), [5])
+        it.seek(b"\xff")
+        self.assertEqual(list(memoryview(it.next_columnar(1, key_width=2, signed_keys=True).int_keys)), [-3])
+        it.seek(b"\xff")
+        self.assertEqual(list(memoryview(it.next_columnar(1, key_width=2).int_keys)), [0xfffd])
+        # Keys of another width cannot be decoded. The batch ends before the
+        # first one, which then raises without being skipped.
+        it.seek(b"\x00")
+        self.assertEqual(list(memoryview(it.next_columnar(10, key_width=2).int_keys)), [5])
+        self.assertRaises(RuntimeError, it.next_columnar, 10, key_width=2)
+        self.assertEqual(it.next_columnar(1).to_list(), self.items[:1])
+        self.assertRaises(ValueError, it.next_columnar, 1, key_width=9)
+        it.close()
+
+    def test_range_columnar(self):
+        batches = list(self.db.range_columnar(self.cfh, b"key010", b"key050", batch_size=16))
+        self.assertEqual([len(b) for b in batches], [16, 16, 8])
+        self.assertEqual([row for b in batches for row in b.to_list()], self.items[10:50])
+
+    @unittest.skipUnless(HAVE_NUMPY, "numpy is not installed")
+    def test_to_numpy(self):
+        import numpy as np
+        batch = next(self.db.range_columnar(self.cfh, None, None))
+        arrays = batch.to_numpy()
+        self.assertEqual(arrays["key_offsets"].dtype, np.int64)
+        self.assertEqual(len(arrays["key_offsets"]), len(self.items) + 1)
+        start, end = arrays["key_offsets"][42], arrays["key_offsets"][43]
+        self.assertEqual(arrays["key_data"][start:end].tobytes(), b"key042")
+        self.assertFalse(arrays["value_data"].flags.writeable)
+
+    @unittest.skipUnless(HAVE_PYARROW, "pyarrow is not installed")
+    def test_to_arrow(self):
+        import pyarrow as pa
+        table = pa.Table.from_batches(b.to_arrow() for b in self.db.range_columnar(self.cfh, None, None, batch_size=30))
+        self.assertEqual(table.schema.field("key").type, pa.large_binary())
+        self.assertEqual(table.num_rows, len(self.items))
+        self.assertEqual(list(zip(table.column("key").to_pylist(), table.column("value").to_pylist())), self.items)
+
+if __name__ == "__main__":
+    unittest.main()
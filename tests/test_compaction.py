@@ -53,4 +53,115 @@ class TestCompaction(unittest.TestCase):
         compaction_occurred = check_log_for_occurrence(log_file_path, compaction_patterns)
         
         # Assert that compaction actually happened
-        self.assertTrue(compaction_occurred, "Manual compaction did not occur according to the LOG file")
\ No newline at end of file
+        self.assertTrue(compaction_occurred, "Manual compaction did not occur according to the LOG file")
+
+    def fill(self, cfh, n=1000, prefix="key"):
+        for i in range(n):
+            self.db.put(cfh, f"{prefix}_{i:06d}".encode(), f"value_{i}".encode() * 10)
+
+    def l0_files(self, cfh=None):
+        return self.db.get_int_property("rocksdb.num-files-at-level0", cfh)
+
+    def test_flush(self):
+        other = self.db.create_column_family("other")
+        self.fill(self.default_cfh)
+        self.fill(other)
+        self.assertEqual(self.l0_files(), 0)
+
+        self.db.flush([self.default_cfh])
+        self.assertEqual(self.l0_files(), 1)
+        self.assertEqual(self.l0_files(other), 0)
+
+        self.db.flush()
+        self.assertEqual(self.l0_files(other), 1)
+        self.db.flush_wal(sync=True)
+
+    def test_wait_for_compact(self):
+        self.fill(self.default_cfh)
+        self.assertTrue(self.db.wait_for_compact(flush=True, timeout_ms=60_000))
+        self.assertGreater(self.db.get_int_property("rocksdb.total-sst-files-size"), 0)
+        self.assertEqual(self.db.get_int_property("rocksdb.mem-table-flush-pending"), 0)
+
+    def test_pause_background_work(self):
+        self.db.set_options(self.default_cfh, {"disable_auto_compactions": True, "level0_file_num_compaction_trigger": 2})
+        for i in range(4):
+            self.fill(self.default_cfh, 10, f"batch{i}")
+            self.db.flush()
+        self.db.pause_background_work()
+        # The compaction this makes due cannot be scheduled, so waiting would never end
+        self.db.enable_auto_compaction()
+        self.assertRaises(RuntimeError, self.db.wait_for_compact, abort_on_pause=True)
+        self.assertEqual(self.l0_files(), 4)
+
+        self.db.continue_background_work()
+        self.assertTrue(self.db.wait_for_compact(timeout_ms=60_000))
+        self.assertLess(self.l0_files(), 4)
+
+    def test_enable_auto_compaction(self):
+        self.db.set_options(self.default_cfh, {"disable_auto_compactions": True, "level0_file_num_compaction_trigger": 2})
+        for i in range(4):
+            self.fill(self.default_cfh, 10, f"batch{i}")
+            self.db.flush()
+        self.db.wait_for_compact()
+        self.assertEqual(self.l0_files(), 4)
+
+        self.db.enable_auto_compaction()
+        self.assertFalse(self.db.get_options(self.default_cfh).disable_auto_compactions)
+        self.assertTrue(self.db.wait_for_compact())
+        self.assertLess(self.l0_files(), 4)
+
+    def test_bulk_load(self):
+        other = self.db.create_column_family("other")
+        trigger = self.db.get_options(self.default_cfh).level0_file_num_compaction_trigger
+        with self.db.bulk_load(db_options={"max_background_jobs": 4}):
+            options = self.db.get_options(other)
+            self.assertTrue(options.disable_auto_compactions)
+            self.assertEqual(options.level0_stop_writes_trigger, 1 << 30)
+            self.assertEqual(self.db.get_db_options().max_background_jobs, 4)
+            for i in range(8):
+                self.fill(self.default_cfh, 100, f"batch{i}")
+                self.fill(other, 100, f"batch{i}")
+                self.db.flush()
+            self.assertEqual(self.l0_files(), 8)
+
+        # Options are restored, and the loaded data is flushed and compacted
+        options = self.db.get_options(self.default_cfh)
+        self.assertFalse(options.disable_auto_compactions)
+        self.assertEqual(options.level0_file_num_compaction_trigger, trigger)
+        self.assertEqual(self.db.get_db_options().max_background_jobs, self.default_dbo.max_background_jobs)
+        self.assertEqual(self.l0_files(), 0)
+        self.assertEqual(self.l0_files(other), 0)
+        self.assertEqual(self.db.get(other, b"batch7_000099"), b"value_99" * 10)
+
+    def test_bulk_load_error_restores_options(self):
+        with self.assertRaises(KeyError):
+            with self.db.bulk_load([self.default_cfh], cf_options={"write_buffer_size": 8 << 20}):
+                self.fill(self.default_cfh, 10)
+                raise KeyError("abort")
+        options = self.db.get_options(self.default_cfh)
+        self.assertFalse(options.disable_auto_compactions)
+        self.assertEqual(options.write_buffer_size, self.default_cfo.write_buffer_size)
+        # A failed load is neither flushed nor compacted
+        self.assertEqual(self.l0_files(), 0)
+        self.assertIsNotNone(self.db.get(self.default_cfh, b"key_000009"))
+
+    def test_bulk_load_restores_enum_options(self):
+        compression = self.db.get_options(self.default_cfh).compression
+        with self.db.bulk_load([self.default_cfh], compact=False, cf_options={"compression": "kNoCompression"}):
+            self.assertEqual(self.db.get_options(self.default_cfh).compression, CompressionType.NO_COMPRESSION)
+        self.assertEqual(self.db.get_options(self.default_cfh).compression, compression)
+
+        # Nothing is applied when an option cannot be saved
+        with self.assertRaises(ValueError):
+            with self.db.bulk_load([self.default_cfh], cf_options={"no_such_option": 1}):
+                pass
+        self.assertFalse(self.db.get_options(self.default_cfh).disable_auto_compactions)
+
+    def test_prepare_for_bulk_load(self):
+        cfo = CFOptions()
+        cfo.prepare_for_bulk_load()
+        self.assertTrue(cfo.disable_auto_compactions)
+        self.assertEqual(cfo.num_levels, 2)
+        self.assertEqual(cfo.to_dict()["soft_pending_compaction_bytes_limit"], 0)
+
+        DBOptions().prepare_for_bulk_load()
@@ -0,0 +1,142 @@
+import os
+import shutil
+import struct
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, CompactRangeOptions, CompactionFilter, MergeOperator, Env, MockTimeEnv
+
+class TestCompactionFilter(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_compaction_filter"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+        self.db = None
+
+    def tearDown(self):
+        if self.db is not None:
+            self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def open(self, compaction_filter, merge_operator=None):
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        cfo = CFOptions()
+        cfo.compaction_filter = compaction_filter
+        if merge_operator is not None:
+            cfo.merge_operator = merge_operator
+        self.db = RocksDB.open(self.db_path, dbo, cfo)
+        self.cfh = self.db.get_column_family_handle("default")
+
+    def compact(self):
+        self.db.compact_range(CompactRangeOptions(), None, None)
+
+    def keys(self):
+        return [k for k, _ in self.db.range(self.cfh, None, None)]
+
+    def test_drop_prefixes(self):
+        f = CompactionFilter.drop_prefixes([b"tmp:", b"cache:"])
+        self.assertEqual(f.name, "pyrocks11.DropPrefixes")
+        self.open(f, MergeOperator.string_append())
+        for key in (b"tmp:1", b"tmp:2", b"cache:x", b"keep:1", b"tmp"):
+            self.db.put(self.cfh, key, b"v")
+        self.db.merge(self.cfh, b"cache:y", b"operand")
+        # Filters only run during compaction
+        self.assertEqual(len(self.keys()), 6)
+        self.assertEqual(f.dropped, 0)
+
+        self.compact()
+        self.assertEqual(self.keys(), [b"keep:1", b"tmp"])
+        self.assertEqual(f.dropped, 4)
+        self.assertGreaterEqual(f.processed, 6)
+
+        f.reset_counters()
+        self.assertEqual((f.processed, f.dropped), (0, 0))
+
+    def test_expiry(self):
+        env = MockTimeEnv()
+        f = CompactionFilter.expiry(offset=1, width=8, env=env)
+        self.open(f)
+        now = int(time.time())
+        self.db.put(self.cfh, b"soon", b"\x01" + struct.pack(">Q", now + 100) + b"payload")
+        self.db.put(self.cfh, b"later", b"\x01" + struct.pack(">Q", now + 1000) + b"payload")
+        self.db.put(self.cfh, b"past", b"\x01" + struct.pack(">Q", now - 10))
+        # Too short to hold a timestamp, so it is kept
+        self.db.put(self.cfh, b"short", b"\x01\x02")
+
+        self.compact()
+        self.assertEqual(self.keys(), [b"later", b"short", b"soon"])
+        self.assertEqual(f.dropped, 1)
+
+        env.advance(500)
+        self.compact()
+        self.assertEqual(self.keys(), [b"later", b"short"])
+        self.assertEqual(f.dropped, 2)
+
+    def test_env_parameter(self):
+        # Any Env is accepted, MockTimeEnv is one of them
+        self.assertIsInstance(MockTimeEnv(), Env)
+        f = CompactionFilter.expiry(offset=1, width=8, env=Env.default())
+        self.open(f)
+        now = int(time.time())
+        self.db.put(self.cfh, b"past", b"\x01" + struct.pack(">Q", now - 10))
+        self.db.put(self.cfh, b"later", b"\x01" + struct.pack(">Q", now + 1000))
+        self.compact()
+        self.assertEqual(self.keys(), [b"later"])
+
+        dbo = DBOptions()
+        self.assertEqual(dbo.env.name, Env.default().name)
+        env = MockTimeEnv()
+        dbo.env = env
+        self.assertIs(dbo.env, env)
+        dbo.env = None
+        self.assertEqual(dbo.env.name, Env.default().name)
+
+    def test_expiry_milliseconds_little_endian(self):
+        f = CompactionFilter.expiry(width=8, big_endian=False, milliseconds=True)
+        self.open(f)
+        now_ms = int(time.time() * 1000)
+        self.db.put(self.cfh, b"expired", struct.pack("<Q", now_ms - 60_000))
+        self.db.put(self.cfh, b"live", struct.pack("<Q", now_ms + 3_600_000))
+        self.compact()
+        self.assertEqual(self.keys(), [b"live"])
+
+    def test_keep_latest_versions(self):
+        f = CompactionFilter.keep_latest_versions(2, prefix_len=7, key_prefix=b"ev:")
+        self.open(f)
+        # Inverted timestamps make the newest version of each entity sort first
+        def key(entity, ts):
+            return b"ev:" + entity + struct.pack(">Q", (1 << 64) - 1 - ts)
+        for ts in range(5):
+            self.db.put(self.cfh, key(b"aaaa", ts), b"v")
+        self.db.put(self.cfh, key(b"bbbb", 7), b"v")
+        for i in range(3):
+            self.db.put(self.cfh, b"other" + bytes([i]), b"v")
+
+        self.compact()
+        self.assertEqual(self.keys(), [key(b"aaaa", 4), key(b"aaaa", 3), key(b"bbbb", 7)] +
+                         [b"other" + bytes([i]) for i in range(3)])
+        self.assertEqual(f.dropped, 3)
+
+        # A newer version pushes out the oldest remaining one
+        self.db.put(self.cfh, key(b"aaaa", 9), b"v")
+        self.compact()
+        self.assertEqual(self.keys()[:2], [key(b"aaaa", 9), key(b"aaaa", 4)])
+        self.assertEqual(f.dropped, 4)
+
+    def test_options(self):
+        cfo = CFOptions()
+        self.assertIsNone(cfo.compaction_filter)
+        self.assertIsNone(cfo.to_dict()["compaction_filter"])
+        cfo.compaction_filter = CompactionFilter.keep_latest_versions(1, 4)
+        self.assertEqual(cfo.to_dict()["compaction_filter"], "pyrocks11.KeepLatestVersions")
+
+    def test_invalid_arguments(self):
+        self.assertRaises(ValueError, CompactionFilter.expiry, width=3)
+        self.assertRaises(ValueError, CompactionFilter.keep_latest_versions, 0, 4)
+        self.assertRaises(ValueError, CompactionFilter.keep_latest_versions, 1, 2, b"long")
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,7 +1,8 @@
 import os
 import shutil
 import unittest
-from pyrocks11 import RocksDB, DBOptions, CompressionType, CFOptions
+from pyrocks11 import RocksDB, DBOptions, CompressionType, CFOptions, CompactRangeOptions, WriteBatch
+from pyrocks11 import ReadOptions, WriteOptions, ReadTier, IOPriority, IteratorOptions
 
 class TestDB(unittest.TestCase):
     def setUp(self):
@@ -56,3 +57,112 @@ class TestDB(unittest.TestCase):
     def test_nonexistent_key(self):
         # Try to get a key that doesn't exist
         self.assertEqual(self.db.get(self.default_cf,b"nonexistent"), None)
+
+    def test_multi_get(self):
+        for i in range(100):
+            self.db.put(self.default_cf, f"key{i:03d}".encode(), f"value{i}".encode())
+
+        # Unsorted input with a missing key; results follow input order
+        keys = [b"key050", b"missing", b"key001", b"key099", b"key050"]
+        self.assertEqual(self.db.multi_get(self.default_cf, keys),
+                         [b"value50", None, b"value1", b"value99", b"value50"])
+
+        self.assertEqual(self.db.multi_get(self.default_cf, []), [])
+
+    def test_get_pinned(self):
+        value = os.urandom(256 * 1024)
+        self.db.put(self.default_cf, b"blob", value)
+        self.db.compact_range(CompactRangeOptions(), None, None)
+
+        pinned = self.db.get_pinned(self.default_cf, b"blob")
+        self.assertEqual(len(pinned), len(value))
+        view = memoryview(pinned)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.tobytes(), value)
+        self.assertEqual(bytes(pinned), value)
+
+        # The view stays valid after the value is overwritten
+        self.db.put(self.default_cf, b"blob", b"small")
+        self.assertEqual(view[:16].tobytes(), value[:16])
+        del view, pinned
+
+        self.assertIsNone(self.db.get_pinned(self.default_cf, b"nonexistent"))
+
+    def test_close_with_live_handles(self):
+        for i in range(10):
+            self.db.put(self.default_cf, f"key{i}".encode(), b"value")
+        self.db.compact_range(CompactRangeOptions(), None, None)
+
+        # A pinned block would keep the files open after close
+        pinned = self.db.get_pinned(self.default_cf, b"key1")
+        self.assertRaises(RuntimeError, self.db.close)
+        del pinned
+
+        opts = IteratorOptions()
+        opts.pin_data = True
+        it = self.db.iterator(self.default_cf, opts)
+        it.seek_to_first()
+        view = it.value_view()
+        self.assertRaises(RuntimeError, self.db.close)
+        del view
+
+        # Iterators are closed with the database, and its LOCK file is released
+        it = self.db.iterator(self.default_cf)
+        self.db.close()
+        self.assertRaises(RuntimeError, it.seek_to_first)
+        dbo = DBOptions()
+        self.db = RocksDB.open(self.db_path, dbo, CFOptions())
+        self.assertEqual(self.db.get(self.db.get_column_family_handle("default"), b"key1"), b"value")
+
+    def test_write_options(self):
+        wo = WriteOptions()
+        wo.disableWAL = True
+        wo.no_slowdown = True
+        wo.rate_limiter_priority = IOPriority.IO_LOW
+        self.assertEqual(wo.to_dict()["disableWAL"], True)
+
+        # One options object reused across calls
+        for i in range(10):
+            self.db.put(self.default_cf, f"key{i}".encode(), b"value", wo)
+        self.db.delete(self.default_cf, b"key0", write_options=wo)
+        batch = WriteBatch()
+        batch.put(self.default_cf, b"key1", b"batched")
+        self.db.write(batch, wo)
+        self.assertIsNone(self.db.get(self.default_cf, b"key0"))
+        self.assertEqual(self.db.get(self.default_cf, b"key1"), b"batched")
+
+        # RocksDB rejects a synced write without a WAL
+        wo.sync = True
+        with self.assertRaises(RuntimeError):
+            self.db.put(self.default_cf, b"key2", b"value", wo)
+
+    def test_read_options(self):
+        ro = ReadOptions()
+        ro.verify_checksums = False
+        ro.async_io = True
+        ro.deadline = 0
+        ro.io_timeout = 50_000
+        self.assertEqual(ro.io_timeout, 50_000)
+        self.assertEqual(ro.to_dict()["async_io"], True)
+
+        for i in range(100):
+            self.db.put(self.default_cf, f"key{i:03d}".encode(), f"value{i}".encode())
+        self.db.compact_range(CompactRangeOptions(), None, None)
+
+        self.assertEqual(self.db.get(self.default_cf, b"key001", read_options=ro), b"value1")
+        self.assertEqual(self.db.multi_get(self.default_cf, [b"key002", b"missing"], read_options=ro), [b"value2", None])
+        self.assertEqual(bytes(self.db.get_pinned(self.default_cf, b"key003", read_options=ro)), b"value3")
+        self.assertEqual(len(list(self.db.range(self.default_cf, b"key010", b"key020", read_options=ro))), 10)
+
+        # A cache-only read cannot be served until the block has been loaded. The
+        # reads above cached the default column family's block, so use a fresh one.
+        cold = self.db.create_column_family("cold")
+        self.db.put(cold, b"key050", b"value50")
+        self.db.compact_range(CompactRangeOptions(), None, None, cold)
+        cache_only = ReadOptions()
+        cache_only.read_tier = ReadTier.kBlockCacheTier
+        with self.assertRaises(RuntimeError):
+            self.db.get(cold, b"key050", read_options=cache_only)
+        self.db.get(cold, b"key050")
+        self.assertEqual(self.db.get(cold, b"key050", read_options=cache_only), b"value50")
+
@@ -0,0 +1,115 @@
+import os
+import shutil
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, CompactRangeOptions, WriteBatch
+from tests.utils import benchmarks_enabled
+
+class TestDeleteRange(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_delete_range"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        cfo = CFOptions()
+        cfo.write_buffer_size = 256 * 1024
+        # Small SST files, so that whole files fall inside the ranges test_drop_files deletes
+        cfo.target_file_size_base = 32 * 1024
+        self.db = RocksDB.open(self.db_path, dbo, cfo)
+        self.cfh = self.db.get_column_family_handle("default")
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def _fill(self, tenants, per_tenant):
+        for t in range(tenants):
+            for i in range(per_tenant):
+                self.db.put(self.cfh, f"t{t:02d}:{i:06d}".encode(), b"v" * 32)
+
+    def _keys(self):
+        return [k for k, _ in self.db.range(self.cfh, None, None)]
+
+    def test_delete_range(self):
+        self._fill(3, 100)
+        self.db.delete_range(self.cfh, b"t01:", b"t01;")
+        keys = self._keys()
+        self.assertEqual(len(keys), 200)
+        self.assertFalse(any(k.startswith(b"t01:") for k in keys))
+        self.assertIsNone(self.db.get(self.cfh, b"t01:000050"))
+        self.assertEqual(self.db.get(self.cfh, b"t02:000050"), b"v" * 32)
+
+        # The end key is exclusive
+        self.db.delete_range(self.cfh, b"t00:000000", b"t00:000010")
+        self.assertIsNone(self.db.get(self.cfh, b"t00:000009"))
+        self.assertIsNotNone(self.db.get(self.cfh, b"t00:000010"))
+
+        # Later writes are not affected by the tombstone
+        self.db.put(self.cfh, b"t01:000001", b"new")
+        self.assertEqual(self.db.get(self.cfh, b"t01:000001"), b"new")
+
+    def test_snapshot_sees_deleted_range(self):
+        self._fill(2, 50)
+        with self.db.snapshot() as snapshot:
+            self.db.delete_range(self.cfh, b"t00:", b"t00;")
+            self.assertIsNone(self.db.get(self.cfh, b"t00:000001"))
+            self.assertEqual(self.db.get(self.cfh, b"t00:000001", snapshot), b"v" * 32)
+
+    def test_batch_delete_range(self):
+        self._fill(2, 50)
+        batch = WriteBatch()
+        batch.delete_range(self.cfh, b"t00:", b"t00;")
+        batch.put(self.cfh, b"t00:999999", b"kept")
+        self.assertEqual(batch.count(), 2)
+        self.db.write(batch)
+        self.assertEqual(self._keys()[0], b"t00:999999")
+        self.assertEqual(len(self._keys()), 51)
+
+    def test_drop_files(self):
+        self._fill(4, 5000)
+        self.db.compact_range(CompactRangeOptions(), None, None)
+        size_before = self.db.get_int_property("rocksdb.total-sst-files-size")
+
+        self.db.delete_range(self.cfh, b"t00:", b"t03:", drop_files=True)
+        self.assertLess(self.db.get_int_property("rocksdb.total-sst-files-size"), size_before)
+        keys = self._keys()
+        self.assertEqual(len(keys), 5000)
+        self.assertTrue(all(k.startswith(b"t03:") for k in keys))
+
+        # Without a range tombstone only whole files go away
+        self.db.delete_files_in_range(self.cfh, None, None)
+        self.assertEqual(self._keys(), [])
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_reads_after_delete_benchmark(self):
+        n_deleted, n_reads = 200000, 20000
+        for i in range(n_deleted):
+            self.db.put(self.cfh, f"a{i:08d}".encode(), b"v" * 32)
+        for i in range(n_reads):
+            self.db.put(self.cfh, f"b{i:08d}".encode(), b"v" * 32)
+        live = [f"b{i:08d}".encode() for i in range(0, n_reads, 7)]
+
+        def measure():
+            start = time.perf_counter()
+            first = next(iter(self.db.range(self.cfh, None, None)))
+            for key in live:
+                self.db.get(self.cfh, key)
+            scanned = sum(1 for _ in self.db.range(self.cfh, None, None))
+            return time.perf_counter() - start, first, scanned
+
+        baseline, _, _ = measure()
+        self.db.delete_range(self.cfh, b"a", b"b")
+        after, first, scanned = measure()
+        print(f"\nreads before range delete: {baseline * 1e3:.1f} ms, after: {after * 1e3:.1f} ms")
+        self.assertEqual(first[0], b"b00000000")
+        self.assertEqual(scanned, n_reads)
+        # The deleted keys are skipped as a range, not one tombstone at a time
+        self.assertLess(after, baseline * 2)
+
+if __name__ == '__main__':
+    unittest.main()
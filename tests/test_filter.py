@@ -0,0 +1,95 @@
+import os
+import shutil
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, BlockBasedTableOptions, FilterPolicy, PrefixExtractor
+from pyrocks11 import CompactRangeOptions, IteratorOptions, Cache
+from tests.utils import benchmarks_enabled
+
+class TestFilter(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_filter"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def tearDown(self):
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def _open(self, filter_policy=None, prefix_extractor=None):
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+
+        bbto = BlockBasedTableOptions()
+        bbto.block_cache = Cache.lru(1024 * 1024)
+        if filter_policy is not None:
+            bbto.filter_policy = filter_policy
+        cfo = CFOptions()
+        cfo.set_block_based_table(bbto)
+        if prefix_extractor is not None:
+            cfo.prefix_extractor = prefix_extractor
+            cfo.memtable_prefix_bloom_size_ratio = 0.1
+        return RocksDB.open(self.db_path, dbo, cfo)
+
+    def _fill(self, db, n):
+        cfh = db.get_column_family_handle("default")
+        for i in range(n):
+            db.put(cfh, f"user{i % 10:02d}:{i:08d}".encode(), b"v" * 64)
+        db.compact_range(CompactRangeOptions(), None, None)
+        return cfh
+
+    def test_filter_policy_options(self):
+        bbto = BlockBasedTableOptions()
+        bbto.filter_policy = FilterPolicy.ribbon(9.9, bloom_before_level=1)
+        self.assertIn("ribbon", bbto.filter_policy.name.lower())
+        self.assertIsNotNone(bbto.to_dict()["filter_policy"])
+
+        cfo = CFOptions()
+        cfo.prefix_extractor = PrefixExtractor.capped(4)
+        cfo.optimize_filters_for_hits = True
+        self.assertIn("capped", cfo.to_dict()["prefix_extractor"].lower())
+        self.assertTrue(cfo.to_dict()["optimize_filters_for_hits"])
+
+    def test_bloom_point_lookups(self):
+        for policy in (FilterPolicy.bloom(10), FilterPolicy.ribbon(10)):
+            db = self._open(policy)
+            cfh = self._fill(db, 2000)
+            self.assertEqual(db.get(cfh, b"user03:00000003"), b"v" * 64)
+            self.assertIsNone(db.get(cfh, b"user03:99999999"))
+            db.close()
+            shutil.rmtree(self.db_path)
+
+    def test_prefix_scan(self):
+        db = self._open(FilterPolicy.bloom(10), PrefixExtractor.fixed(7))
+        cfh = self._fill(db, 1000)
+
+        opts = IteratorOptions()
+        opts.prefix_same_as_start = True
+        it = db.iterator(cfh, opts)
+        it.seek(b"user04:")
+        keys = [k for k, _ in it]
+        self.assertEqual(len(keys), 100)
+        self.assertTrue(all(k.startswith(b"user04:") for k in keys))
+        db.close()
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_negative_lookup_benchmark(self):
+        n_keys, n_lookups = 200000, 50000
+        missing = [f"user{i % 10:02d}:{i:08d}x".encode() for i in range(n_lookups)]
+
+        results = {}
+        for name, policy in (("none", None), ("bloom", FilterPolicy.bloom(10)), ("ribbon", FilterPolicy.ribbon(10))):
+            db = self._open(policy)
+            cfh = self._fill(db, n_keys)
+            start = time.perf_counter()
+            for key in missing:
+                db.get(cfh, key)
+            results[name] = (time.perf_counter() - start) / n_lookups * 1e6
+            print(f"\nnegative get, filter={name}: {results[name]:.2f} us")
+            db.close()
+            shutil.rmtree(self.db_path)
+
+        self.assertLess(results["bloom"], results["none"])
+        self.assertLess(results["ribbon"], results["none"])
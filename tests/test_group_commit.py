@@ -0,0 +1,150 @@
+import os
+import shutil
+import struct
+import threading
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, MergeOperator, WriteOptions
+from tests.utils import benchmarks_enabled
+
+class TestGroupCommit(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_group_commit"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        cfo = CFOptions()
+        cfo.merge_operator = MergeOperator.uint64_add()
+        self.db = RocksDB.open(self.db_path, dbo, cfo)
+        self.cfh = self.db.get_column_family_handle("default")
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def test_operations(self):
+        self.db.put(self.cfh, b"gone", b"x")
+        with self.db.group_commit_writer() as writer:
+            writer.put(self.cfh, b"a", b"1")
+            writer.merge(self.cfh, b"n", struct.pack("<Q", 3))
+            writer.delete(self.cfh, b"gone")
+            # wait=True returns once the write is in the DB
+            self.assertEqual(self.db.get(self.cfh, b"a"), b"1")
+            self.assertEqual(self.db.get(self.cfh, b"n"), struct.pack("<Q", 3))
+            self.assertIsNone(self.db.get(self.cfh, b"gone"))
+            self.assertEqual(writer.operations_written, 3)
+
+    def test_fire_and_forget(self):
+        writer = self.db.group_commit_writer(max_count=0, max_bytes=0, max_delay_us=10_000_000)
+        for i in range(100):
+            writer.put(self.cfh, f"key{i:03d}".encode(), b"v", wait=False)
+        # Nothing is due yet
+        self.assertIsNone(self.db.get(self.cfh, b"key000"))
+        writer.flush()
+        self.assertEqual(writer.batches_written, 1)
+        self.assertEqual(len(list(self.db.range(self.cfh, None, None))), 100)
+        writer.close()
+        with self.assertRaises(RuntimeError):
+            writer.put(self.cfh, b"late", b"v")
+
+    def test_count_threshold(self):
+        with self.db.group_commit_writer(max_count=10, max_delay_us=10_000_000) as writer:
+            for i in range(9):
+                writer.put(self.cfh, f"key{i:03d}".encode(), b"v", wait=False)
+            # The tenth write fills the batch, so it is written long before max_delay_us
+            start = time.perf_counter()
+            writer.put(self.cfh, b"key009", b"v")
+            self.assertLess(time.perf_counter() - start, 5)
+            self.assertEqual(writer.batches_written, 1)
+            self.assertEqual(writer.operations_written, 10)
+
+    def test_concurrent_writers_share_batches(self):
+        n_threads, n_writes = 8, 200
+        with self.db.group_commit_writer(max_delay_us=2000) as writer:
+            def worker(t):
+                for i in range(n_writes):
+                    writer.put(self.cfh, f"t{t}:{i:04d}".encode(), b"v")
+
+            threads = [threading.Thread(target=worker, args=(t,)) for t in range(n_threads)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            self.assertEqual(writer.operations_written, n_threads * n_writes)
+            self.assertLess(writer.batches_written, n_threads * n_writes)
+        self.assertEqual(len(list(self.db.range(self.cfh, None, None))), n_threads * n_writes)
+
+    def test_db_close_writes_pending(self):
+        writer = self.db.group_commit_writer(max_count=0, max_bytes=0, max_delay_us=10_000_000)
+        writer.put(self.cfh, b"k", b"v", wait=False)
+        self.db.close()
+
+        dbo = DBOptions()
+        self.db = RocksDB.open(self.db_path, dbo, CFOptions())
+        cfh = self.db.get_column_family_handle("default")
+        self.assertEqual(self.db.get(cfh, b"k"), b"v")
+
+    def test_native_close_stops_writer(self):
+        writer = self.db.group_commit_writer(max_count=0, max_bytes=0, max_delay_us=10_000_000)
+        writer.put(self.cfh, b"k", b"v", wait=False)
+        # Closing the native DB directly, without the Python finalizers
+        self.db._db.close()
+        with self.assertRaises(RuntimeError):
+            writer.put(self.cfh, b"late", b"v", wait=False)
+        writer.flush()
+        self.db.close()
+
+        self.db = RocksDB.open(self.db_path, DBOptions(), CFOptions())
+        cfh = self.db.get_column_family_handle("default")
+        self.assertEqual(self.db.get(cfh, b"k"), b"v")
+
+    def test_waited_error_not_reported_again(self):
+        # Sync writes without WAL are rejected by DB::Write
+        wo = WriteOptions()
+        wo.sync = True
+        wo.disableWAL = True
+        with self.db.group_commit_writer(wo, max_delay_us=1000) as writer:
+            with self.assertRaises(RuntimeError):
+                writer.put(self.cfh, b"a", b"1")
+            # The waiter raised it, so flush() does not
+            writer.flush()
+
+            writer.put(self.cfh, b"b", b"1", wait=False)
+            with self.assertRaises(RuntimeError):
+                writer.flush()
+            writer.flush()
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_synced_writes_benchmark(self):
+        n_threads, n_writes = 16, 200
+        wo = WriteOptions()
+        wo.sync = True
+
+        def run(put):
+            def worker(t):
+                for i in range(n_writes):
+                    put(f"t{t:02d}:{i:06d}".encode(), b"v" * 100)
+            threads = [threading.Thread(target=worker, args=(t,)) for t in range(n_threads)]
+            start = time.perf_counter()
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            return time.perf_counter() - start
+
+        direct = run(lambda key, value: self.db.put(self.cfh, key, value, wo))
+        with self.db.group_commit_writer(wo) as writer:
+            grouped = run(lambda key, value: writer.put(self.cfh, key, value))
+            batches = writer.batches_written
+        total = n_threads * n_writes
+        print(f"\n{total} synced puts from {n_threads} threads: DB.put {total / direct:.0f}/s, "
+              f"group commit {total / grouped:.0f}/s in {batches} batches")
+        self.assertLess(grouped, direct)
+
+if __name__ == '__main__':
+    unittest.main()
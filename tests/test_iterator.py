@@ -1,7 +1,9 @@
 import os
 import shutil
+import time
 import unittest
-from pyrocks11 import RocksDB, DBOptions
+from pyrocks11 import RocksDB, DBOptions, CompactRangeOptions, IteratorOptions
+from tests.utils import benchmarks_enabled
 
 class TestIterator(unittest.TestCase):
     def setUp(self):
@@ -102,3 +104,109 @@ class TestIterator(unittest.TestCase):
         ]
         
         self.assertEqual(pairs, expected)
+
+    def test_iterator_next_batch(self):
+        it = self.db.iterator(self.default_cf)
+        it.seek(b"key2")
+
+        self.assertEqual(it.next_batch(2), [(b"key2", b"value2"), (b"key3", b"value3")])
+        # The iterator is left on the first row not returned
+        self.assertEqual(it.key(), b"key4")
+
+        # max_bytes stops the chunk early but always returns at least one row
+        self.assertEqual(it.next_batch(10, max_bytes=1), [(b"key4", b"value4")])
+        self.assertEqual(it.next_batch(10), [(b"key5", b"value5")])
+        self.assertEqual(it.next_batch(10), [])
+
+    def test_iterator_python_iteration_chunks(self):
+        it = self.db.iterator(self.default_cf)
+        it.batch_size = 2
+        it.seek_to_first()
+
+        self.assertEqual(next(it), (b"key1", b"value1"))
+        self.assertEqual([k for k, _ in it], [b"key2", b"key3", b"key4", b"key5"])
+
+        # Seeking discards rows buffered by a previous chunk
+        it.seek_to_first()
+        self.assertEqual(next(it), (b"key1", b"value1"))
+        it.seek(b"key4")
+        self.assertEqual(list(it), [(b"key4", b"value4"), (b"key5", b"value5")])
+
+    def test_iterator_bounds(self):
+        opts = IteratorOptions()
+        opts.lower_bound = b"key2"
+        opts.upper_bound = b"key4"
+        opts.fill_cache = False
+        self.assertEqual(opts.to_dict()["upper_bound"], b"key4")
+
+        it = self.db.iterator(self.default_cf, opts)
+        it.seek_to_first()
+        self.assertEqual([k for k, _ in it], [b"key2", b"key3"])
+
+        # The upper bound is exclusive, also when walking backwards
+        it.seek_to_last()
+        self.assertEqual(it.key(), b"key3")
+
+    def test_range(self):
+        self.assertEqual(list(self.db.range(self.default_cf, b"key2", b"key4")),
+                         [(b"key2", b"value2"), (b"key3", b"value3")])
+        self.assertEqual([k for k, _ in self.db.range(self.default_cf, b"key2", b"key4", reverse=True)],
+                         [b"key3", b"key2"])
+        self.assertEqual([k for k, _ in self.db.range(self.default_cf, None, b"key3")], [b"key1", b"key2"])
+        self.assertEqual([k for k, _ in self.db.range(self.default_cf, b"key4", None)], [b"key4", b"key5"])
+        self.assertEqual(list(self.db.range(self.default_cf, b"key6", None)), [])
+
+        # The options passed in keep their own bounds
+        opts = IteratorOptions()
+        opts.readahead_size = 2 * 1024 * 1024
+        self.assertEqual(len(list(self.db.range(self.default_cf, b"key1", b"key3", options=opts))), 2)
+        self.assertIsNone(opts.lower_bound)
+
+    def test_iterator_value_view(self):
+        # key1..key5 are still in the memtable, so their views are copies
+        it = self.db.iterator(self.default_cf)
+        it.seek(b"key2")
+        view = memoryview(it.value_view())
+        it.next()
+        self.assertEqual(view.tobytes(), b"value2")
+
+        # Once flushed to an SST, pin_data lets views reference the block directly
+        self.db.compact_range(CompactRangeOptions(), None, None)
+        opts = IteratorOptions()
+        opts.pin_data = True
+        it = self.db.iterator(self.default_cf, opts)
+        it.seek_to_first()
+        views = []
+        while it.valid():
+            views.append(memoryview(it.value_view()))
+            it.next()
+        self.assertEqual([v.tobytes() for v in views], [f"value{i}".encode() for i in range(1, 6)])
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_scan_benchmark(self):
+        n_rows = 200000
+        for i in range(n_rows):
+            self.db.put(self.default_cf, f"bench{i:08d}".encode(), b"v" * 32)
+        self.db.compact_range(CompactRangeOptions(), None, None)
+
+        # One native call per valid/key/value/next, as before chunked iteration
+        it = self.db.iterator(self.default_cf)
+        it.seek_to_first()
+        start = time.perf_counter()
+        rows = 0
+        while it.valid():
+            it.key()
+            it.value()
+            it.next()
+            rows += 1
+        per_row = rows / (time.perf_counter() - start)
+
+        it = self.db.iterator(self.default_cf)
+        it.seek_to_first()
+        start = time.perf_counter()
+        chunked = sum(1 for _ in it)
+        per_chunk = chunked / (time.perf_counter() - start)
+
+        print(f"\nper-row calls: {per_row:.0f} rows/sec, chunked: {per_chunk:.0f} rows/sec")
+        self.assertEqual(rows, chunked)
+        self.assertGreater(per_chunk, per_row)
@@ -0,0 +1,102 @@
+import os
+import shutil
+import struct
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, CompactRangeOptions, MergeOperator, WriteBatch
+
+def u64(n):
+    return struct.pack("<Q", n)
+
+class TestMerge(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_merge"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        dbo.create_missing_column_families = True
+
+        cfos = {}
+        for name, op in [("default", None),
+                         ("add", MergeOperator.uint64_add()),
+                         ("max", MergeOperator.max()),
+                         ("min", MergeOperator.min()),
+                         ("append", MergeOperator.string_append("|")),
+                         ("or", MergeOperator.bytes_or())]:
+            cfo = CFOptions()
+            if op is not None:
+                cfo.merge_operator = op
+            cfos[name] = cfo
+        self.db = RocksDB.open(self.db_path, dbo, cfos)
+        self.cf = {name: self.db.get_column_family_handle(name) for name in cfos}
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def test_uint64_add(self):
+        cfh = self.cf["add"]
+        for _ in range(100):
+            self.db.merge(cfh, b"counter", u64(3))
+        self.assertEqual(self.db.get(cfh, b"counter"), u64(300))
+
+        # Operands survive flush and compaction
+        self.db.compact_range(CompactRangeOptions(), None, None)
+        self.db.merge(cfh, b"counter", u64(1))
+        self.assertEqual(self.db.get(cfh, b"counter"), u64(301))
+
+        self.db.put(cfh, b"counter", u64(10))
+        self.db.merge(cfh, b"counter", u64(5))
+        self.assertEqual(self.db.get(cfh, b"counter"), u64(15))
+
+        # Wraps around instead of failing
+        self.db.merge(cfh, b"wrap", u64(2**64 - 1))
+        self.db.merge(cfh, b"wrap", u64(2))
+        self.assertEqual(self.db.get(cfh, b"wrap"), u64(1))
+
+    def test_max_min(self):
+        for value in (b"\x00\x05", b"\x00\x09", b"\x00\x01"):
+            self.db.merge(self.cf["max"], b"k", value)
+            self.db.merge(self.cf["min"], b"k", value)
+        self.assertEqual(self.db.get(self.cf["max"], b"k"), b"\x00\x09")
+        self.assertEqual(self.db.get(self.cf["min"], b"k"), b"\x00\x01")
+
+    def test_string_append(self):
+        cfh = self.cf["append"]
+        for value in (b"a", b"b", b"c"):
+            self.db.merge(cfh, b"k", value)
+        self.assertEqual(self.db.get(cfh, b"k"), b"a|b|c")
+
+    def test_bytes_or(self):
+        cfh = self.cf["or"]
+        self.db.merge(cfh, b"k", b"\x01\x00")
+        self.db.merge(cfh, b"k", b"\x02")
+        self.db.merge(cfh, b"k", b"\x00\x10\x80")
+        self.assertEqual(self.db.get(cfh, b"k"), b"\x03\x10\x80")
+
+    def test_batch_merge(self):
+        batch = WriteBatch()
+        batch.merge(self.cf["add"], b"counter", u64(2))
+        batch.merge(self.cf["add"], b"counter", u64(40))
+        batch.merge(self.cf["append"], b"k", b"x")
+        self.db.write(batch)
+        self.assertEqual(self.db.get(self.cf["add"], b"counter"), u64(42))
+        self.assertEqual(self.db.get(self.cf["append"], b"k"), b"x")
+
+    def test_no_merge_operator(self):
+        with self.assertRaises(RuntimeError):
+            self.db.merge(self.cf["default"], b"k", b"v")
+
+    def test_options(self):
+        cfo = CFOptions()
+        self.assertIsNone(cfo.to_dict()["merge_operator"])
+        cfo.merge_operator = MergeOperator.string_append()
+        self.assertEqual(cfo.merge_operator.name, "pyrocks11.StringAppend")
+        self.assertEqual(cfo.to_dict()["merge_operator"], "pyrocks11.StringAppend")
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,117 @@
+import os
+import shutil
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions
+from tests.utils import benchmarks_enabled
+
+class TestParallelScan(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_parallel_scan"
+        self.sst_dir = "test_database_parallel_scan_sst"
+        # Clean up any existing database
+        for path in (self.db_path, self.sst_dir):
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        self.db = RocksDB.open(self.db_path, dbo, CFOptions())
+        self.cfh = self.db.get_column_family_handle("default")
+
+        # Eight non-overlapping SST files give the scan boundaries to split at
+        self.items = [(f"key{i:05d}".encode(), f"value{i}".encode()) for i in range(4000)]
+        self.db.bulk_ingest(self.cfh, self.items, self.sst_dir, partitions=8)
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        for path in (self.db_path, self.sst_dir):
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+    def test_ordered(self):
+        with self.db.parallel_scan(self.cfh, threads=4, partitions=8, batch_size=100) as scan:
+            self.assertGreater(len(scan.partitions), 1)
+            self.assertEqual(list(scan), self.items)
+
+    def test_partitions(self):
+        scan = self.db.parallel_scan(self.cfh, b"key01000", b"key03000", threads=2, partitions=4)
+        partitions = scan.partitions
+        self.assertLessEqual(len(partitions), 4)
+        self.assertEqual(partitions[0][0], b"key01000")
+        self.assertEqual(partitions[-1][1], b"key03000")
+        # Adjacent partitions share their boundary
+        for (_, upper), (lower, _) in zip(partitions, partitions[1:]):
+            self.assertEqual(upper, lower)
+        self.assertEqual(list(scan), self.items[1000:3000])
+        scan.close()
+
+    def test_unordered(self):
+        scan = self.db.parallel_scan(self.cfh, threads=4, partitions=8, ordered=False, batch_size=64, max_pending=1)
+        chunks = list(scan.chunks())
+        self.assertTrue(all(0 < len(chunk) <= 64 for chunk in chunks))
+        self.assertEqual(sorted(row for chunk in chunks for row in chunk), self.items)
+
+    def test_aggregate(self):
+        stats = self.db.parallel_scan(self.cfh, threads=4).aggregate()
+        self.assertEqual(stats["count"], len(self.items))
+        self.assertEqual(stats["key_bytes"], sum(len(k) for k, _ in self.items))
+        self.assertEqual(stats["value_bytes"], sum(len(v) for _, v in self.items))
+        self.assertEqual(stats["min_key"], self.items[0][0])
+        self.assertEqual(stats["max_key"], self.items[-1][0])
+
+        self.assertEqual(self.db.parallel_scan(self.cfh, b"key00100", b"key00200").count(), 100)
+
+        stats = self.db.parallel_scan(self.cfh, b"zzz").aggregate()
+        self.assertEqual(stats["count"], 0)
+        self.assertIsNone(stats["min_key"])
+        self.assertIsNone(stats["max_key"])
+
+    def test_consistent_state(self):
+        # Writes after the scan is created are not seen by any partition
+        scan = self.db.parallel_scan(self.cfh, threads=4, partitions=8)
+        self.db.put(self.cfh, b"key00000", b"changed")
+        self.db.put(self.cfh, b"key99999", b"added")
+        self.assertEqual(list(scan), self.items)
+
+        snapshot = self.db.snapshot()
+        self.db.delete(self.cfh, b"key00001")
+        self.assertEqual(self.db.parallel_scan(self.cfh, snapshot=snapshot).count(), len(self.items) + 1)
+        self.assertEqual(self.db.parallel_scan(self.cfh).count(), len(self.items))
+
+    def test_single_use(self):
+        scan = self.db.parallel_scan(self.cfh, threads=2)
+        scan.aggregate()
+        self.assertRaises(RuntimeError, scan.aggregate)
+        self.assertRaises(RuntimeError, lambda: list(scan))
+
+    def test_close(self):
+        # Closing stops workers waiting for room in the queue
+        scan = self.db.parallel_scan(self.cfh, threads=4, batch_size=10, max_pending=1)
+        it = iter(scan)
+        self.assertEqual(next(it), self.items[0])
+        self.db.close()
+        self.assertRaises(RuntimeError, lambda: list(it))
+
+    def test_invalid_arguments(self):
+        self.assertRaises(ValueError, self.db.parallel_scan, self.cfh, threads=0)
+        self.assertRaises(ValueError, self.db.parallel_scan, self.cfh, batch_size=0)
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_benchmark_count(self):
+        items = [(f"bench{i:08d}".encode(), os.urandom(100)) for i in range(400_000)]
+        self.db.bulk_ingest(self.cfh, items, self.sst_dir, partitions=64)
+        total = len(items) + len(self.items)
+
+        start = time.perf_counter()
+        self.assertEqual(sum(1 for _ in self.db.range(self.cfh, None, None)), total)
+        serial = time.perf_counter() - start
+
+        start = time.perf_counter()
+        self.assertEqual(self.db.parallel_scan(self.cfh).count(), total)
+        parallel = time.perf_counter() - start
+        print(f"\ncount {total} keys: range() {serial * 1000:.1f} ms, parallel_scan().count() {parallel * 1000:.1f} ms")
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,92 @@
+import os
+import shutil
+import subprocess
+import sys
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, DbOpenSecondary
+
+# Primary running in its own process: reads "<key> <value>" lines from stdin,
+# writes them and answers "ok" once each write is done.
+WRITER = """
+import sys
+from pyrocks11 import RocksDB, DBOptions, CFOptions
+dbo = DBOptions()
+dbo.create_if_missing = True
+db = RocksDB.open(sys.argv[1], dbo, CFOptions())
+cfh = db.get_column_family_handle("default")
+print("ready", flush=True)
+for line in sys.stdin:
+    key, value = line.split()
+    db.put(cfh, key.encode(), value.encode())
+    print("ok", flush=True)
+db.close()
+"""
+
+class TestSecondary(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_primary"
+        self.secondary_paths = ["test_database_secondary_a", "test_database_secondary_b"]
+        # Clean up any existing databases
+        for path in [self.db_path] + self.secondary_paths:
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+        self.writer = subprocess.Popen([sys.executable, "-c", WRITER, self.db_path],
+                                       stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True)
+        self.assertEqual(self.writer.stdout.readline().strip(), "ready")
+
+        self.dbo = DBOptions()
+        self.dbo.max_open_files = -1
+
+    def tearDown(self):
+        self.writer.stdin.close()
+        self.writer.wait(timeout=30)
+        self.writer.stdout.close()
+        # Clean up
+        for path in [self.db_path] + self.secondary_paths:
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+    def _write(self, key, value):
+        self.writer.stdin.write(f"{key} {value}\n")
+        self.writer.stdin.flush()
+        self.assertEqual(self.writer.stdout.readline().strip(), "ok")
+
+    def test_try_catch_up_with_primary(self):
+        self._write("k1", "v1")
+        with RocksDB.open(self.db_path, self.dbo, CFOptions(), DbOpenSecondary(self.secondary_paths[0])) as db:
+            cfh = db.get_column_family_handle("default")
+            self.assertEqual(db.get(cfh, b"k1"), b"v1")
+
+            self._write("k2", "v2")
+            self.assertIsNone(db.get(cfh, b"k2"))
+            db.try_catch_up_with_primary()
+            self.assertEqual(db.get(cfh, b"k2"), b"v2")
+
+            with self.assertRaises(RuntimeError):
+                db.put(cfh, b"k3", b"v3")
+
+    def test_background_catch_up(self):
+        readers = [RocksDB.open(self.db_path, self.dbo, CFOptions(), DbOpenSecondary(path, catch_up_interval_ms=20))
+                   for path in self.secondary_paths]
+        try:
+            for i in range(3):
+                self._write(f"key{i}", f"value{i}")
+                for db in readers:
+                    cfh = db.get_column_family_handle("default")
+                    deadline = time.monotonic() + 10
+                    while db.get(cfh, f"key{i}".encode()) is None and time.monotonic() < deadline:
+                        time.sleep(0.01)
+                    self.assertEqual(db.get(cfh, f"key{i}".encode()), f"value{i}".encode())
+
+            readers[0].stop_catch_up()
+            self._write("late", "value")
+            time.sleep(0.2)
+            self.assertIsNone(readers[0].get(readers[0].get_column_family_handle("default"), b"late"))
+        finally:
+            for db in readers:
+                db.close()
+
+if __name__ == '__main__':
+    unittest.main()
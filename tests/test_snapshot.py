@@ -0,0 +1,139 @@
+import os
+import shutil
+import threading
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, ReadOptions
+
+class TestSnapshot(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_snapshot"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        dbo.create_missing_column_families = True
+
+        self.db = RocksDB.open(self.db_path, dbo, {"default": CFOptions(), "cf1": CFOptions()})
+        self.default_cf = self.db.get_column_family_handle("default")
+        self.cf1 = self.db.get_column_family_handle("cf1")
+
+        for i in range(100):
+            self.db.put(self.default_cf, f"key{i:03d}".encode(), b"old")
+        self.db.put(self.cf1, b"key000", b"old")
+
+    def tearDown(self):
+        # Close the database
+        self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def test_concurrent_writes_not_visible(self):
+        snapshot = self.db.snapshot()
+        self.assertTrue(snapshot.valid)
+
+        def writer():
+            for i in range(100):
+                self.db.put(self.default_cf, f"key{i:03d}".encode(), b"new")
+                self.db.put(self.default_cf, f"added{i:03d}".encode(), b"new")
+            self.db.put(self.cf1, b"key000", b"new")
+            self.db.delete(self.cf1, b"key000")
+
+        t = threading.Thread(target=writer)
+        t.start()
+        t.join()
+
+        # The latest state sees the writes
+        self.assertEqual(self.db.get(self.default_cf, b"key000"), b"new")
+        self.assertEqual(self.db.get(self.cf1, b"key000"), None)
+
+        # The snapshot does not, on every read path
+        self.assertEqual(self.db.get(self.default_cf, b"key000", snapshot), b"old")
+        self.assertEqual(self.db.get(self.default_cf, b"added000", snapshot), None)
+        self.assertEqual(self.db.multi_get(self.default_cf, [b"key050", b"added050"], snapshot), [b"old", None])
+        self.assertEqual(self.db.multi_get_cf([self.default_cf, self.cf1], [b"key001", b"key000"], snapshot), [b"old", b"old"])
+
+        it = self.db.iterator(self.default_cf, snapshot=snapshot)
+        it.seek_to_first()
+        rows = list(it)
+        self.assertEqual(len(rows), 100)
+        self.assertTrue(all(v == b"old" for _, v in rows))
+
+        self.assertEqual(len(list(self.db.range(self.default_cf, b"a", b"z", snapshot=snapshot))), 100)
+        self.assertEqual(len(list(self.db.range(self.default_cf, b"a", b"z"))), 200)
+
+        snapshot.release()
+
+    def test_release(self):
+        with self.db.snapshot() as snapshot:
+            self.assertGreater(snapshot.sequence_number, 0)
+            self.db.put(self.default_cf, b"key000", b"new")
+            self.assertEqual(self.db.get(self.default_cf, b"key000", snapshot), b"old")
+
+        self.assertFalse(snapshot.valid)
+        self.assertRaises(RuntimeError, self.db.get, self.default_cf, b"key000", snapshot)
+
+        # Releasing twice is harmless
+        self.db.release_snapshot(snapshot)
+
+    def test_iterator_outlives_snapshot(self):
+        snapshot = self.db.snapshot()
+        it = self.db.iterator(self.default_cf, snapshot=snapshot)
+        snapshot.release()
+
+        self.db.put(self.default_cf, b"key000", b"new")
+        it.seek_to_first()
+        self.assertEqual(it.value(), b"old")
+
+    def test_close_invalidates_snapshot(self):
+        snapshot = self.db.snapshot()
+        self.db.close()
+        self.assertFalse(snapshot.valid)
+        snapshot.release()
+
+    def test_read_options_snapshot(self):
+        snapshot = self.db.snapshot()
+        ro = ReadOptions()
+        ro.snapshot = snapshot
+        self.assertIs(ro.snapshot, snapshot)
+        self.db.put(self.default_cf, b"key000", b"new")
+        self.db.put(self.default_cf, b"added000", b"new")
+
+        self.assertEqual(self.db.get(self.default_cf, b"key000", read_options=ro), b"old")
+        self.assertEqual(self.db.multi_get(self.default_cf, [b"key000", b"added000"], read_options=ro), [b"old", None])
+        self.assertEqual(len(list(self.db.range(self.default_cf, b"a", b"z", read_options=ro))), 100)
+
+        # A snapshot passed to the call takes precedence
+        latest = self.db.snapshot()
+        self.assertEqual(self.db.get(self.default_cf, b"key000", latest, read_options=ro), b"new")
+        latest.release()
+
+        snapshot.release()
+        self.assertRaises(RuntimeError, self.db.get, self.default_cf, b"key000", read_options=ro)
+
+        ro.snapshot = None
+        self.assertEqual(self.db.get(self.default_cf, b"key000", read_options=ro), b"new")
+
+    def test_release_snapshot_of_other_db(self):
+        other_path = self.db_path + "_other"
+        if os.path.exists(other_path):
+            shutil.rmtree(other_path)
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        other = RocksDB.open(other_path, dbo, {"default": CFOptions()})
+        try:
+            snapshot = self.db.snapshot()
+            self.assertRaises(ValueError, other.release_snapshot, snapshot)
+            self.assertRaises(ValueError, other._db.release_snapshot, snapshot._snapshot)
+            self.assertRaises(RuntimeError, other.get, other.get_column_family_handle("default"), b"key000", snapshot)
+
+            # Still registered with its owner, which releases it
+            self.assertTrue(snapshot.valid)
+            self.assertEqual(self.db.get(self.default_cf, b"key000", snapshot), b"old")
+            self.db.release_snapshot(snapshot)
+            self.assertFalse(snapshot.valid)
+        finally:
+            other.close()
+            shutil.rmtree(other_path)
@@ -0,0 +1,118 @@
+import os
+import random
+import shutil
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, SstFileWriter, write_sst_files
+
+class TestSst(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_sst"
+        self.sst_dir = "test_database_sst_files"
+        # Clean up any existing database
+        for path in (self.db_path, self.sst_dir):
+            if os.path.exists(path):
+                shutil.rmtree(path)
+        os.makedirs(self.sst_dir)
+        self.db = RocksDB.open(self.db_path)
+        self.default_cf = self.db.get_column_family_handle("default")
+
+    def tearDown(self):
+        self.db.close()
+        # Clean up
+        for path in (self.db_path, self.sst_dir):
+            if os.path.exists(path):
+                shutil.rmtree(path)
+
+    def test_writer_and_ingest(self):
+        path = os.path.join(self.sst_dir, "a.sst")
+        with SstFileWriter(path) as writer:
+            writer.put(b"key000", b"value0")
+            writer.put_many([(f"key{i:03d}".encode(), f"value{i}".encode()) for i in range(1, 100)])
+            self.assertGreater(writer.file_size, 0)
+        self.assertEqual(writer.info["num_entries"], 100)
+        self.assertEqual(writer.info["smallest_key"], b"key000")
+        self.assertEqual(writer.info["largest_key"], b"key099")
+
+        self.db.put(self.default_cf, b"key050", b"old")
+        self.db.ingest_external_file([path], self.default_cf)
+        self.assertEqual(self.db.get(self.default_cf, b"key000"), b"value0")
+        self.assertEqual(self.db.get(self.default_cf, b"key050"), b"value50")
+        self.assertTrue(os.path.exists(path))
+
+    def test_unsorted_keys_rejected(self):
+        writer = SstFileWriter(os.path.join(self.sst_dir, "b.sst"))
+        writer.put(b"key2", b"v")
+        with self.assertRaises(RuntimeError):
+            writer.put(b"key1", b"v")
+        with self.assertRaises(RuntimeError):
+            writer.put_many([(b"key3", b"v"), (b"key3", b"v")])
+
+    def test_snapshot_consistency(self):
+        path = os.path.join(self.sst_dir, "c.sst")
+        with SstFileWriter(path) as writer:
+            writer.put(b"key", b"ingested")
+        with self.db.snapshot() as snapshot:
+            self.db.ingest_external_file([path], self.default_cf, move_files=True)
+            self.assertIsNone(self.db.get(self.default_cf, b"key", snapshot))
+        self.assertEqual(self.db.get(self.default_cf, b"key"), b"ingested")
+
+    def test_write_sst_files(self):
+        items = [(f"key{i:06d}".encode(), f"value{i}".encode()) for i in range(10000)]
+        random.shuffle(items)
+        # Duplicate key, the later pair wins
+        items.append((b"key000042", b"last"))
+
+        paths = write_sst_files(self.sst_dir, items, partitions=4, threads=4)
+        self.assertGreaterEqual(len(paths), 1)
+        self.assertLessEqual(len(paths), 4)
+        self.assertEqual(paths, sorted(paths))
+
+        self.db.ingest_external_file(paths, self.default_cf, move_files=True)
+        self.assertEqual(self.db.get(self.default_cf, b"key000042"), b"last")
+        self.assertEqual(self.db.get(self.default_cf, b"key009999"), b"value9999")
+        self.assertEqual(sum(1 for _ in self.db.range(self.default_cf, None, None)), 10000)
+
+    def test_bulk_ingest(self):
+        items = [(f"key{i:06d}".encode(), b"x" * 10) for i in reversed(range(5000))]
+        self.db.bulk_ingest(self.default_cf, items, self.sst_dir, partitions=3)
+        self.assertEqual(sum(1 for _ in self.db.range(self.default_cf, None, None)), 5000)
+        self.assertEqual(os.listdir(self.sst_dir), [])
+        self.assertEqual(self.db.bulk_ingest(self.default_cf, [], self.sst_dir), [])
+
+    def test_write_sst_files_spills_runs(self):
+        def items():
+            order = list(range(20000))
+            random.shuffle(order)
+            for i in order:
+                yield f"key{i:06d}".encode(), f"value{i}".encode()
+            # Duplicate of a key spilled in an earlier run, the later pair wins
+            yield b"key000042", b"last"
+
+        # About 20 chunks, each sorted into a run and merged at the end
+        paths = write_sst_files(self.sst_dir, items(), partitions=4, threads=2, memory_limit=64 << 10)
+        self.assertEqual(sorted(os.listdir(self.sst_dir)), sorted(os.path.basename(p) for p in paths))
+
+        self.db.ingest_external_file(paths, self.default_cf, move_files=True)
+        self.assertEqual(self.db.get(self.default_cf, b"key000042"), b"last")
+        self.assertEqual(self.db.get(self.default_cf, b"key019999"), b"value19999")
+        keys = [k for k, _ in self.db.range(self.default_cf, None, None)]
+        self.assertEqual(keys, [f"key{i:06d}".encode() for i in range(20000)])
+
+    def test_bulk_ingest_failure_leaves_no_files(self):
+        def items():
+            for i in range(20000):
+                yield f"key{i:06d}".encode(), b"x" * 10
+            raise KeyError("abort")
+
+        with self.assertRaises(KeyError):
+            self.db.bulk_ingest(self.default_cf, items(), self.sst_dir, memory_limit=64 << 10)
+        self.assertEqual(os.listdir(self.sst_dir), [])
+        self.assertIsNone(self.db.get(self.default_cf, b"key000000"))
+
+        infos = self.db.bulk_ingest(self.default_cf, ((f"key{i:06d}".encode(), b"x") for i in range(100)), self.sst_dir)
+        self.assertEqual(sum(info["num_entries"] for info in infos), 100)
+        self.assertEqual(infos[0]["smallest_key"], b"key000000")
+        self.assertNotIn("file_path", infos[0])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,91 @@
+import os
+import shutil
+import threading
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, CompactRangeOptions, Statistics, StatsLevel, PerfLevel, PerfContext
+
+class TestStats(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_stats"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def tearDown(self):
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def _open(self, statistics=None):
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        if statistics is not None:
+            dbo.statistics = statistics
+        return RocksDB.open(self.db_path, dbo, CFOptions())
+
+    def test_statistics(self):
+        stats = Statistics()
+        stats.stats_level = StatsLevel.kExceptDetailedTimers
+        self.assertEqual(stats.stats_level, StatsLevel.kExceptDetailedTimers)
+
+        with self._open(stats) as db:
+            cfh = db.get_column_family_handle("default")
+            for i in range(100):
+                db.put(cfh, f"key{i:03d}".encode(), b"value")
+            for i in range(100):
+                db.get(cfh, f"key{i:03d}".encode())
+
+            snapshot = stats.to_dict()
+            self.assertEqual(snapshot["tickers"]["rocksdb.number.keys.written"], 100)
+            self.assertEqual(snapshot["tickers"]["rocksdb.number.keys.read"], 100)
+            self.assertEqual(stats.ticker("rocksdb.number.keys.written"), 100)
+            get_hist = snapshot["histograms"]["rocksdb.db.get.micros"]
+            self.assertEqual(get_hist["count"], 100)
+            self.assertLessEqual(get_hist["median"], get_hist["p99"])
+
+            stats.reset()
+            self.assertEqual(stats.ticker("rocksdb.number.keys.written"), 0)
+            with self.assertRaises(ValueError):
+                stats.ticker("rocksdb.no.such.ticker")
+
+    def test_properties(self):
+        with self._open() as db:
+            cfh = db.get_column_family_handle("default")
+            for i in range(100):
+                db.put(cfh, f"key{i:03d}".encode(), b"value")
+            db.compact_range(CompactRangeOptions(), None, None)
+
+            self.assertIn("Compaction Stats", db.get_property("rocksdb.stats"))
+            self.assertEqual(db.get_int_property("rocksdb.num-live-versions", cfh), 1)
+            self.assertGreater(db.get_int_property("rocksdb.estimate-num-keys"), 0)
+            cfstats = db.get_map_property("rocksdb.cfstats")
+            self.assertIsInstance(cfstats, dict)
+            self.assertTrue(cfstats)
+
+            self.assertIsNone(db.get_property("rocksdb.no-such-property"))
+            self.assertIsNone(db.get_int_property("rocksdb.no-such-property"))
+
+        with self.assertRaises(RuntimeError):
+            db.get_property("rocksdb.stats")
+
+    def test_perf_context(self):
+        with self._open() as db:
+            cfh = db.get_column_family_handle("default")
+            for i in range(10):
+                db.put(cfh, f"key{i:03d}".encode(), b"value")
+
+            with PerfContext(PerfLevel.kEnableCount) as pc:
+                for i in range(10):
+                    db.get(cfh, f"key{i:03d}".encode())
+            self.assertEqual(pc.counters["get_from_memtable_count"], 10)
+            self.assertIn("bytes_read", pc.io_counters)
+
+            # Counters are per thread: work on another thread is not counted
+            with PerfContext(PerfLevel.kEnableCount) as pc:
+                t = threading.Thread(target=lambda: db.get(cfh, b"key000"))
+                t.start()
+                t.join()
+            self.assertEqual(pc.counters["get_from_memtable_count"], 0)
+
+if __name__ == '__main__':
+    unittest.main()
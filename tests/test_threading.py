@@ -0,0 +1,137 @@
+import os
+import shutil
+import threading
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, CompactRangeOptions, WriteBatch
+from tests.utils import benchmarks_enabled
+
+
+class TestThreading(unittest.TestCase):
+    """Blocking RocksDB calls run without the GIL and are safe to share across threads."""
+
+    def setUp(self):
+        self.db_path = "test_database_threading"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        dbo = DBOptions()
+        dbo.create_if_missing = True
+        dbo.increase_parallelism(4)
+
+        self.db = RocksDB.open(self.db_path, dbo, CFOptions())
+        self.default_cf = self.db.get_column_family_handle("default")
+
+    def tearDown(self):
+        # Close the database
+        self.db.close()
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def _run_threads(self, n_threads, target):
+        errors = []
+
+        def wrapper(tid):
+            try:
+                target(tid)
+            except Exception as e:  # pragma: no cover - reported below
+                errors.append(e)
+
+        threads = [threading.Thread(target=wrapper, args=(t,)) for t in range(n_threads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(errors, [])
+
+    def test_concurrent_put_get(self):
+        n_threads, n_keys = 8, 500
+
+        def writer(tid):
+            for i in range(n_keys):
+                self.db.put(self.default_cf, f"t{tid}_{i:05d}".encode(), f"v{tid}_{i}".encode())
+
+        self._run_threads(n_threads, writer)
+
+        def reader(tid):
+            for i in range(n_keys):
+                self.assertEqual(self.db.get(self.default_cf, f"t{tid}_{i:05d}".encode()), f"v{tid}_{i}".encode())
+
+        self._run_threads(n_threads, reader)
+
+    def test_concurrent_batches_and_iterators(self):
+        n_threads = 4
+
+        def writer(tid):
+            batch = WriteBatch()
+            for i in range(100):
+                batch.put(self.default_cf, f"b{tid}_{i:03d}".encode(), b"x")
+            self.db.write(batch)
+
+        self._run_threads(n_threads, writer)
+
+        def scanner(tid):
+            it = self.db.iterator(self.default_cf)
+            it.seek(f"b{tid}_".encode())
+            count = 0
+            while it.valid() and it.key().startswith(f"b{tid}_".encode()):
+                count += 1
+                it.next()
+            self.assertEqual(count, 100)
+
+        self._run_threads(n_threads, scanner)
+
+    def test_compaction_does_not_block_interpreter(self):
+        for i in range(20000):
+            self.db.put(self.default_cf, f"key_{i:08d}".encode(), os.urandom(100))
+
+        stop = threading.Event()
+        ticks = [0]
+
+        def ticker():
+            while not stop.is_set():
+                ticks[0] += 1
+
+        t = threading.Thread(target=ticker)
+        t.start()
+        try:
+            # The ticker's rate while this thread waits without the GIL
+            before = ticks[0]
+            time.sleep(0.2)
+            rate = (ticks[0] - before) / 0.2
+
+            before = ticks[0]
+            start = time.perf_counter()
+            self.db.compact_range(CompactRangeOptions(), None, None)
+            elapsed = time.perf_counter() - start
+            during = ticks[0] - before
+        finally:
+            stop.set()
+            t.join()
+
+        # The ticker thread kept running Python code for most of the compaction,
+        # not just until compact_range was entered
+        self.assertGreaterEqual(during, rate * elapsed / 2)
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_read_scaling_benchmark(self):
+        n_keys, value = 2000, os.urandom(64 * 1024)
+        for i in range(n_keys):
+            self.db.put(self.default_cf, f"key_{i:08d}".encode(), value)
+        self.db.compact_range(CompactRangeOptions(), None, None)
+
+        def reader(_):
+            for i in range(n_keys):
+                self.db.get(self.default_cf, f"key_{i:08d}".encode())
+
+        rates = {}
+        for n_threads in (1, 2, 4, 8):
+            start = time.perf_counter()
+            self._run_threads(n_threads, reader)
+            rates[n_threads] = n_threads * n_keys / (time.perf_counter() - start)
+            print(f"\n{n_threads} reader thread(s): {rates[n_threads]:.0f} gets/sec")
+
+        if (os.cpu_count() or 1) >= 4:
+            self.assertGreater(rates[4], 2 * rates[1])
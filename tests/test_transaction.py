@@ -0,0 +1,208 @@
+import os
+import shutil
+import struct
+import threading
+import time
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, MergeOperator, WriteOptions
+from pyrocks11 import DbOpenRW, DbOpenTransaction, DbOpenOptimisticTransaction, TransactionConflict
+from tests.utils import benchmarks_enabled
+
+def _u64(n):
+    return struct.pack("<Q", n)
+
+class TestTransaction(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_transaction"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        self.dbo = DBOptions()
+        self.dbo.create_if_missing = True
+        self.cfo = CFOptions()
+        self.cfo.merge_operator = MergeOperator.uint64_add()
+
+    def tearDown(self):
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def _open(self, access_type):
+        db = RocksDB.open(self.db_path, self.dbo, self.cfo, access_type)
+        return db, db.get_column_family_handle("default")
+
+    def test_commit_and_rollback(self):
+        for access_type in (DbOpenTransaction(), DbOpenOptimisticTransaction()):
+            db, cfh = self._open(access_type)
+            with db:
+                db.put(cfh, b"gone", b"x")
+                txn = db.transaction()
+                txn.put(cfh, b"a", b"1")
+                txn.delete(cfh, b"gone")
+                txn.merge(cfh, b"n", _u64(5))
+                # Own writes are visible to the transaction only
+                self.assertEqual(txn.get(cfh, b"a"), b"1")
+                self.assertIsNone(txn.get(cfh, b"gone"))
+                self.assertIsNone(db.get(cfh, b"a"))
+                txn.commit()
+                self.assertEqual(db.get(cfh, b"a"), b"1")
+                self.assertIsNone(db.get(cfh, b"gone"))
+                self.assertEqual(db.get(cfh, b"n"), _u64(5))
+
+                txn = db.transaction()
+                txn.put(cfh, b"b", b"2")
+                txn.rollback()
+                self.assertIsNone(db.get(cfh, b"b"))
+            shutil.rmtree(self.db_path)
+
+    def test_context_manager(self):
+        db, cfh = self._open(DbOpenTransaction())
+        with db:
+            with db.transaction(WriteOptions()) as txn:
+                txn.put(cfh, b"a", b"1")
+            self.assertEqual(db.get(cfh, b"a"), b"1")
+
+            with self.assertRaises(KeyError):
+                with db.transaction() as txn:
+                    txn.put(cfh, b"b", b"2")
+                    raise KeyError("abort")
+            self.assertIsNone(db.get(cfh, b"b"))
+
+    def test_savepoints(self):
+        db, cfh = self._open(DbOpenTransaction())
+        with db:
+            with db.transaction() as txn:
+                txn.put(cfh, b"a", b"1")
+                txn.set_savepoint()
+                txn.put(cfh, b"b", b"2")
+                txn.rollback_to_savepoint()
+                txn.set_savepoint()
+                txn.put(cfh, b"c", b"3")
+                txn.pop_savepoint()
+                with self.assertRaises(RuntimeError):
+                    txn.rollback_to_savepoint()
+            self.assertEqual(db.get(cfh, b"a"), b"1")
+            self.assertIsNone(db.get(cfh, b"b"))
+            self.assertEqual(db.get(cfh, b"c"), b"3")
+
+    def test_snapshot(self):
+        db, cfh = self._open(DbOpenOptimisticTransaction())
+        with db:
+            db.put(cfh, b"k", b"old")
+            txn = db.transaction()
+            self.assertFalse(txn.has_snapshot)
+            txn.set_snapshot()
+            self.assertTrue(txn.has_snapshot)
+            db.put(cfh, b"k", b"new")
+            # Repeatable reads as of the snapshot
+            self.assertEqual(txn.get(cfh, b"k"), b"old")
+            txn.rollback()
+
+    def test_optimistic_conflict(self):
+        db, cfh = self._open(DbOpenOptimisticTransaction())
+        with db:
+            db.put(cfh, b"k", b"0")
+            txn = db.transaction(set_snapshot=True)
+            self.assertEqual(txn.get_for_update(cfh, b"k"), b"0")
+            txn.put(cfh, b"k", b"1")
+            db.put(cfh, b"k", b"other")
+            with self.assertRaises(TransactionConflict):
+                txn.commit()
+            self.assertEqual(db.get(cfh, b"k"), b"other")
+
+    def test_pessimistic_lock_timeout(self):
+        db, cfh = self._open(DbOpenTransaction())
+        with db:
+            first = db.transaction()
+            first.get_for_update(cfh, b"k")
+            second = db.transaction(lock_timeout_ms=10)
+            with self.assertRaises(TransactionConflict):
+                second.put(cfh, b"k", b"2")
+            first.commit()
+            second.put(cfh, b"k", b"2")
+            second.commit()
+            self.assertEqual(db.get(cfh, b"k"), b"2")
+
+    def test_concurrent_increments(self):
+        db, cfh = self._open(DbOpenTransaction())
+        n_threads, n_increments = 8, 200
+        with db:
+            db.put(cfh, b"counter", _u64(0))
+
+            def worker():
+                for _ in range(n_increments):
+                    with db.transaction() as txn:
+                        value = struct.unpack("<Q", txn.get_for_update(cfh, b"counter"))[0]
+                        txn.put(cfh, b"counter", _u64(value + 1))
+
+            threads = [threading.Thread(target=worker) for _ in range(n_threads)]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            self.assertEqual(db.get(cfh, b"counter"), _u64(n_threads * n_increments))
+
+    def test_requires_transaction_db(self):
+        db, cfh = self._open(DbOpenRW())
+        with db:
+            with self.assertRaises(RuntimeError):
+                db.transaction()
+
+    def test_close_with_open_transaction(self):
+        db, cfh = self._open(DbOpenTransaction())
+        txn = db.transaction(set_snapshot=True)
+        txn.put(cfh, b"k", b"v")
+        db.close()
+        with self.assertRaises(RuntimeError):
+            txn.commit()
+
+        db, cfh = self._open(DbOpenTransaction())
+        with db:
+            self.assertIsNone(db.get(cfh, b"k"))
+
+    @unittest.skipUnless(benchmarks_enabled(), "set PYROCKS11_BENCH=1 to run benchmarks")
+    def test_contention_benchmark(self):
+        n_threads, n_increments, n_counters = 8, 2000, 16
+        wo = WriteOptions()
+        wo.sync = True
+        db, cfh = self._open(DbOpenTransaction())
+        with db:
+            keys = [f"counter{i:02d}".encode() for i in range(n_counters)]
+            for key in keys:
+                db.put(cfh, key, _u64(0))
+
+            def run(increment):
+                def worker(offset):
+                    for i in range(n_increments):
+                        increment(keys[(offset + i) % n_counters])
+                threads = [threading.Thread(target=worker, args=(t,)) for t in range(n_threads)]
+                start = time.perf_counter()
+                for t in threads:
+                    t.start()
+                for t in threads:
+                    t.join()
+                return time.perf_counter() - start
+
+            # Read-modify-write serialized by one Python lock
+            lock = threading.Lock()
+            def locked_increment(key):
+                with lock:
+                    value = struct.unpack("<Q", db.get(cfh, key))[0]
+                    db.put(cfh, key, _u64(value + 1), wo)
+
+            # Per-key locks inside RocksDB, commit without the GIL
+            def txn_increment(key):
+                with db.transaction(wo) as txn:
+                    value = struct.unpack("<Q", txn.get_for_update(cfh, key))[0]
+                    txn.put(cfh, key, _u64(value + 1))
+
+            locked = run(locked_increment)
+            transactional = run(txn_increment)
+            print(f"\n{n_threads} threads x {n_increments} synced increments: python lock {locked:.2f} s, "
+                  f"transactions {transactional:.2f} s")
+            total = sum(struct.unpack("<Q", db.get(cfh, key))[0] for key in keys)
+            self.assertEqual(total, 2 * n_threads * n_increments)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,100 @@
+import os
+import shutil
+import unittest
+from pyrocks11 import RocksDB, DBOptions, CFOptions, CompactRangeOptions, DbOpenTTL, MockTimeEnv
+
+class TestTTL(unittest.TestCase):
+    def setUp(self):
+        self.db_path = "test_database_ttl"
+        # Clean up any existing database
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+        self.env = MockTimeEnv()
+        self.dbo = DBOptions()
+        self.dbo.create_if_missing = True
+        self.dbo.create_missing_column_families = True
+        self.dbo.env = self.env
+        self.cfos = {"default": CFOptions(), "sessions": CFOptions()}
+
+    def tearDown(self):
+        # Clean up
+        if os.path.exists(self.db_path):
+            shutil.rmtree(self.db_path)
+
+    def _compact(self, db):
+        db.compact_range(CompactRangeOptions(), None, None)
+
+    def test_expiry(self):
+        with RocksDB.open(self.db_path, self.dbo, self.cfos, DbOpenTTL(100)) as db:
+            cfh = db.get_column_family_handle("default")
+            db.put(cfh, b"old", b"value")
+            self.env.advance(60)
+            db.put(cfh, b"new", b"value")
+
+            # Values come back without the TTL timestamp
+            self.assertEqual(db.get(cfh, b"old"), b"value")
+            self.assertEqual(db.multi_get(cfh, [b"old", b"new"]), [b"value", b"value"])
+            self.assertEqual(list(db.range(cfh, None, None)), [(b"new", b"value"), (b"old", b"value")])
+
+            self.env.advance(60)
+            self._compact(db)
+            self.assertIsNone(db.get(cfh, b"old"))
+            self.assertEqual(db.get(cfh, b"new"), b"value")
+
+            self.env.advance(60)
+            self._compact(db)
+            self.assertIsNone(db.get(cfh, b"new"))
+
+    def test_per_cf_ttl(self):
+        with RocksDB.open(self.db_path, self.dbo, self.cfos, DbOpenTTL(0, ttls={"sessions": 10})) as db:
+            default = db.get_column_family_handle("default")
+            sessions = db.get_column_family_handle("sessions")
+            db.put(default, b"k", b"forever")
+            db.put(sessions, b"k", b"short")
+
+            self.env.advance(3600)
+            self._compact(db)
+            self.assertEqual(db.get(default, b"k"), b"forever")
+            self.assertIsNone(db.get(sessions, b"k"))
+
+            # TTLs can be changed while open
+            db.set_ttl(default, 10)
+            self.env.advance(20)
+            self._compact(db)
+            self.assertIsNone(db.get(default, b"k"))
+
+    def test_read_only(self):
+        with RocksDB.open(self.db_path, self.dbo, self.cfos, DbOpenTTL(1000)) as db:
+            db.put(db.get_column_family_handle("sessions"), b"k", b"v")
+
+        with RocksDB.open(self.db_path, self.dbo, self.cfos, DbOpenTTL(1000, read_only=True)) as db:
+            cfh = db.get_column_family_handle("sessions")
+            self.assertEqual(db.get(cfh, b"k"), b"v")
+            with self.assertRaises(RuntimeError):
+                db.put(cfh, b"k2", b"v")
+
+    def test_handles_after_close(self):
+        db = RocksDB.open(self.db_path, self.dbo, self.cfos, DbOpenTTL(1000))
+        cfh = db.get_column_family_handle("sessions")
+        db.put(cfh, b"k", b"v")
+        db.close()
+        with self.assertRaises(RuntimeError):
+            db.get(cfh, b"k")
+
+        # Reopening as a plain database sees the values with their timestamps
+        with RocksDB.open(self.db_path, self.dbo, self.cfos) as db:
+            raw = db.get(db.get_column_family_handle("sessions"), b"k")
+            self.assertEqual(len(raw), len(b"v") + 4)
+            with self.assertRaises(RuntimeError):
+                db.set_ttl(db.get_column_family_handle("sessions"), 10)
+
+    def test_mock_env(self):
+        self.assertIs(self.dbo.env, self.env)
+        self.env.advance(5)
+        self.assertEqual(self.env.offset, 5)
+        self.dbo.env = None
+        self.assertIsNone(self.dbo.env)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -26,3 +26,11 @@ def check_log_for_occurrence(log_file_path:str, patterns: list[str] = []) -> boo
         print(f"Error reading log file: {e}")
         
     return False
+
+
+def benchmarks_enabled() -> bool:
+    """
+    Benchmarks are slow and timing sensitive, so they only run when the
+    PYROCKS11_BENCH environment variable is set (e.g. PYROCKS11_BENCH=1).
+    """
+    return os.environ.get("PYROCKS11_BENCH", "") not in ("", "0")